@@ -28,17 +28,29 @@
 #include "oxc.h"
 #include <algorithm>                                       // for copy, tran...
 #include <array>                                           // for array, arr...
+#include <atomic>                                          // for atomic
+#include <bit>                                             // for countr_zero
 #include <boost/multiprecision/cpp_int.hpp>                // for cpp_int_ba...
 #include <compare>                                         // for common_com...
+#include <condition_variable>                              // for condition_variable
 #include <cstdlib>                                         // for abs, size_t
-#include <exception>                                       // for exception
+#include <deque>                                           // for deque
+#include <chrono>                                          // for seconds, steady_clock
+#include <exception>                                       // for exception, current_exception
+#include <functional>                                      // for function
+#include <future>                                          // for promise, shared_future
 #include <initializer_list>                                // for initialize...
 #include <iterator>                                        // for back_inser...
 #include <limits>                                          // for numeric_li...
+#include <list>                                            // for list
 #include <map>                                             // for operator==
+#include <mutex>                                           // for call_once, mutex, lock_guard
+#include <numeric>                                         // for partial_sum
 #include <queue>                                           // for queue
+#include <ranges>                                          // for input_range
 #include <set>                                             // for set
 #include <stdexcept>                                       // for runtime_error
+#include <thread>                                          // for thread
 #include <type_traits>                                     // for enable_if<...
 #include <unordered_map>                                   // for unordered_map
 
@@ -53,6 +65,7 @@
 constexpr auto M_COUNT = 12;// day_markers array size
 constexpr auto EMPTY_CJDN = -1;
 constexpr auto MIN_CJDN_VALUE = 1721791;
+constexpr auto JULIAN_CYCLE_YEARS = 532;// период повторения раскладки юлианского года (19*28 лет)
 const char* invalid_date = "ошибка определения даты";
 
 /*----------------------------------------------*/
@@ -61,6 +74,15 @@ const char* invalid_date = "ошибка определения даты";
 
 using ShortDate = std::pair<oxc::Month, oxc::Day> ;
 using ApEvReads = oxc::OrthodoxCalendar::ApostolEvangelieReadings ;
+using DayInfo = oxc::OrthodoxCalendar::DayInfo ;
+using DayView = oxc::OrthodoxCalendar::DayView ;
+using PropertyQuery = oxc::OrthodoxCalendar::PropertyQuery ;
+using BuildPhase = oxc::OrthodoxCalendar::BuildPhase ;
+using CacheEvent = oxc::OrthodoxCalendar::CacheEvent ;
+using CacheEventInfo = oxc::OrthodoxCalendar::CacheEventInfo ;
+using CacheHook = oxc::OrthodoxCalendar::CacheHook ;
+using CacheStats = oxc::OrthodoxCalendar::CacheStats ;
+using Executor = oxc::OrthodoxCalendar::Executor ;
 using big_int = boost::multiprecision::cpp_int;
 using INT = big_int;
 
@@ -86,6 +108,13 @@ big_int string_to_year(const std::string& i)
   return res;
 }
 
+//функц.возвращает год из интервала [JULIAN_CYCLE_YEARS; 2*JULIAN_CYCLE_YEARS), раскладка которого
+//(пасха, дни недели, високосность, отступки) совпадает с раскладкой года y (y>=1)
+big_int canonical_year(const big_int& y)
+{
+  return y % JULIAN_CYCLE_YEARS + JULIAN_CYCLE_YEARS;
+}
+
 namespace oxc {
 
 bool is_leap_year(const Year& y, const CalendarFormat fmt)
@@ -506,6 +535,7 @@ public:
   bool operator<=(const Date::impl& rhs) const;
   bool is_valid() const;
   Year year(const CalendarFormat fmt) const;
+  INT julian_year() const;
   Month month(const CalendarFormat fmt) const;
   Day day(const CalendarFormat fmt) const;
   Weekday weekday() const;
@@ -858,6 +888,15 @@ std::tuple<Year,Month,Day> Date::impl::ymd(const CalendarFormat fmt) const
   return std::make_tuple<Year,Month,Day>({},{},{}) ;
 }
 
+INT Date::impl::julian_year() const
+//число юлианского года без преобразования в строку (см. cjdn2julian)
+{
+  INT k2 = (cjdn_ - 1721118)*4 + 3;
+  int k1 = 5 * fdiv_(static_cast<int>(mod_(k2, INT(1461))), 4) + 2;
+  int c0 = fdiv_(fdiv_(k1, 153) + 2, 12);
+  return fdiv_(k2, INT(1461)) + c0;
+}
+
 INT Date::impl::cjdn() const
 {
   return cjdn_ ;
@@ -1179,13 +1218,1065 @@ std::string Date::format(std::string fmt) const
   return pimpl->format(fmt);
 }
 
+/*----------------------------------------------*/
+/*          liturgy readings tables             */
+/*----------------------------------------------*/
+
+//type alias for const tables
+using TT1 = std::array<std::array<ApEvReads, 7>, 37>;
+using TT2 = std::pair<uint16_t, ApEvReads>;//элемент плоской таблицы, отсортированной по first
+//таблица рядовых чтений на литургии из приложения богосл.евангелия. период от св. троицы до нед. сыропустная
+//двумерный массив [a][b], где а - календарный номер по пятидесятнице. b - деньнедели.
+constexpr TT1 evangelie_table_1 {
+  std::array { ApEvReads{ 0X1B5, "Ин., 27 зач., VII, 37–52; VIII, 12."},  //неделя 0. день св. троицы
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{}
+        },
+  std::array { ApEvReads{ 0X262, "Мф., 38 зач., X, 32–33, 37–38; XIX, 27–30."},  //Неделя 1 всех святых
+          ApEvReads{ 0X4B2, "Мф., 75 зач., XVIII, 10–20."},  //пн - Святаго Духа
+          ApEvReads{ 0XA2, "Мф., 10 зач., IV, 25 – V, 12."},  //вт - седмица 1
+          ApEvReads{ 0XC2, "Мф., 12 зач., V, 20–26."},  //ср
+          ApEvReads{ 0XD2, "Мф., 13 зач., V, 27–32."},  //чт
+          ApEvReads{ 0XE2, "Мф., 14 зач., V, 33–41."},  //пт
+          ApEvReads{ 0XF2, "Мф., 15 зач., V, 42–48."}  //сб
+        },
+  std::array { ApEvReads{ 0X92, "Мф., 9 зач., IV, 18–23."},  //Неделя 2
+          ApEvReads{ 0X132, "Мф., 19 зач., VI, 31–34; VII, 9–11."},  //пн - седмица 2
+          ApEvReads{ 0X162, "Мф., 22 зач., VII, 15–21."},  //вт
+          ApEvReads{ 0X172, "Мф., 23 зач., VII, 21–23."},  //ср
+          ApEvReads{ 0X1B2, "Мф., 27 зач., VIII, 23–27."},  //чт
+          ApEvReads{ 0X1F2, "Мф., 31 зач., IX, 14–17."},  //пт
+          ApEvReads{ 0X142, "Мф., 20 зач., VII, 1–8."}  //сб
+        },
+  std::array { ApEvReads{ 0X122, "Мф., 18 зач., VI, 22–33."},  //Неделя 3
+          ApEvReads{ 0X222, "Мф., 34 зач., IX, 36 – X, 8."},  //пн - седмица 3
+          ApEvReads{ 0X232, "Мф., 35 зач., X, 9–15."},  //вт
+          ApEvReads{ 0X242, "Мф., 36 зач., X, 16–22."},  //ср
+          ApEvReads{ 0X252, "Мф., 37 зач., X, 23–31."},  //чт
+          ApEvReads{ 0X262, "Мф., 38 зач., X, 32–36; XI, 1."},  //пт
+          ApEvReads{ 0X182, "Мф., 24 зач., VII, 24 – VIII, 4."}  //сб
+        },
+  std::array { ApEvReads{ 0X192, "Мф., 25 зач., VIII, 5–13."},  //Неделя 4
+          ApEvReads{ 0X282, "Мф., 40 зач., XI, 2–15."},  //пн - седмица 4
+          ApEvReads{ 0X292, "Мф., 41 зач., XI, 16–20."},  //вт
+          ApEvReads{ 0X2A2, "Мф., 42 зач., XI, 20–26."},  //ср
+          ApEvReads{ 0X2B2, "Мф., 43 зач., XI, 27–30."},  //чт
+          ApEvReads{ 0X2C2, "Мф., 44 зач., XII, 1–8."},  //пт
+          ApEvReads{ 0X1A2, "Мф., 26 зач., VIII, 14–23."}  //сб
+        },
+  std::array { ApEvReads{ 0X1C2, "Мф., 28 зач., VIII, 28 - IX, 1."},  //Неделя 5
+          ApEvReads{ 0X2D2, "Мф., 45 зач., XII, 9-13."},  //пн - седмица 5
+          ApEvReads{ 0X2E2, "Мф., 46 зач., XII, 14–16, 22–30."},  //вт
+          ApEvReads{ 0X302, "Мф., 48 зач., XII, 38–45."},  //ср
+          ApEvReads{ 0X312, "Мф., 49 зач., XII, 46 – XIII, 3."},  //чт
+          ApEvReads{ 0X322, "Мф., 50 зач., XIII, 3–9."},  //пт
+          ApEvReads{ 0X1E2, "Мф., 30 зач., IX, 9–13."}  //сб
+        },
+  std::array { ApEvReads{ 0X1D2, "Мф., 29 зач., IX, 1–8."},  //Неделя 6
+          ApEvReads{ 0X332, "Мф., 51 зач., XIII, 10–23."},  //пн - седмица 6
+          ApEvReads{ 0X342, "Мф., 52 зач., XIII, 24–30."},  //вт
+          ApEvReads{ 0X352, "Мф., 53 зач., XIII, 31–36."},  //ср
+          ApEvReads{ 0X362, "Мф., 54 зач., XIII, 36–43."},  //чт
+          ApEvReads{ 0X372, "Мф., 55 зач., XIII, 44–54."},  //пт
+          ApEvReads{ 0X202, "Мф., 32 зач., IX, 18–26."}  //сб
+        },
+  std::array { ApEvReads{ 0X212, "Мф., 33 зач., IX, 27–35."},  //Неделя 7
+          ApEvReads{ 0X382, "Мф., 56 зач., XIII, 54–58."},  //пн - седмица 7
+          ApEvReads{ 0X392, "Мф., 57 зач., XIV, 1–13."},  //вт
+          ApEvReads{ 0X3C2, "Мф., 60 зач., XIV, 35 – XV, 11."},  //ср
+          ApEvReads{ 0X3D2, "Мф., 61 зач., XV, 12–21."},  //чт
+          ApEvReads{ 0X3F2, "Мф., 63 зач., XV, 29–31."},  //пт
+          ApEvReads{ 0X272, "Мф., 39 зач., X, 37 – XI, 1."}  //сб
+        },
+  std::array { ApEvReads{ 0X3A2, "Мф., 58 зач., XIV, 14–22."},  //Неделя 8
+          ApEvReads{ 0X412, "Мф., 65 зач., XVI, 1-6."},  //пн - седмица 8
+          ApEvReads{ 0X422, "Мф., 66 зач., XVI, 6-12."},  //вт
+          ApEvReads{ 0X442, "Мф., 68 зач., XVI, 20–24."},  //ср
+          ApEvReads{ 0X452, "Мф., 69 зач., XVI, 24–28."},  //чт
+          ApEvReads{ 0X472, "Мф., 71 зач., XVII, 10-18."},  //пт
+          ApEvReads{ 0X2F2, "Мф., 47 зач., XII, 30–37."}  //сб
+        },
+  std::array { ApEvReads{ 0X3B2, "Мф., 59 зач., XIV, 22–34."},  //Неделя 9
+          ApEvReads{ 0X4A2, "Мф., 74 зач., XVIII, 1–11."},  //пн - седмица 9
+          ApEvReads{ 0X4C2, "Мф., 76 зач., XVIII, 18–22; XIX, 1–2, 13–15."},  //вт
+          ApEvReads{ 0X502, "Мф., 80 зач., XX, 1–16."},  //ср
+          ApEvReads{ 0X512, "Мф., 81 зач., XX, 17–28."},  //чт
+          ApEvReads{ 0X532, "Мф., 83 зач., XXI, 1–11, 15–17."},  //пт
+          ApEvReads{ 0X402, "Мф., 64 зач., XV, 32–39."}  //сб
+        },
+  std::array { ApEvReads{ 0X482, "Мф., 72 зач., XVII, 14–23."},  //Неделя 10
+          ApEvReads{ 0X542, "Мф., 84 зач., XXI, 18–22."},  //пн - седмица 10
+          ApEvReads{ 0X552, "Мф., 85 зач., XXI, 23–27."},  //вт
+          ApEvReads{ 0X562, "Мф., 86 зач., XXI, 28–32."},  //ср
+          ApEvReads{ 0X582, "Мф., 88 зач., XXI, 43-46."},  //чт
+          ApEvReads{ 0X5B2, "Мф., 91 зач., XXII, 23–33."},  //пт
+          ApEvReads{ 0X492, "Мф., 73 зач., XVII, 24 – XVIII, 4."}  //сб
+        },
+  std::array { ApEvReads{ 0X4D2, "Мф., 77 зач., XVIII, 23–35."},  //Неделя 11
+          ApEvReads{ 0X5E2, "Мф., 94 зач., XXIII, 13–22."},  //пн - седмица 11
+          ApEvReads{ 0X5F2, "Мф., 95 зач., XXIII, 23-28."},  //вт
+          ApEvReads{ 0X602, "Мф., 96 зач., XXIII, 29–39."},  //ср
+          ApEvReads{ 0X632, "Мф., 99 зач., XXIV, 13–28."},  //чт
+          ApEvReads{ 0X642, "Мф., 100 зач., XXIV, 27–33, 42–51."},  //пт
+          ApEvReads{ 0X4E2, "Мф., 78 зач., XIX, 3–12."}  //сб
+        },
+  std::array { ApEvReads{ 0X4F2, "Мф., 79 зач., XIX, 16–26."},  //Неделя 12
+          ApEvReads{ 0X23, "Мк., 2 зач., I, 9–15."},  //пн - седмица 12
+          ApEvReads{ 0X33, "Мк., 3 зач., I, 16–22."},  //вт
+          ApEvReads{ 0X43, "Мк., 4 зач., I, 23–28."},  //ср
+          ApEvReads{ 0X53, "Мк., 5 зач., I, 29-35."},  //чт
+          ApEvReads{ 0X93, "Мк., 9 зач., II, 18–22."},  //пт
+          ApEvReads{ 0X522, "Мф., 82 зач., XX, 29–34."}  //сб
+        },
+  std::array { ApEvReads{ 0X572, "Мф., 87 зач., XXI, 33–42."},  //Неделя 13
+          ApEvReads{ 0XB3, "Мк., 11 зач., III, 6–12."},  //пн - седмица 13
+          ApEvReads{ 0XC3, "Мк., 12 зач., III, 13–19."},  //вт
+          ApEvReads{ 0XD3, "Мк., 13 зач., III, 20–27."},  //ср
+          ApEvReads{ 0XE3, "Мк., 14 зач., III, 28–35."},  //чт
+          ApEvReads{ 0XF3, "Мк., 15 зач., IV, 1–9."},  //пт
+          ApEvReads{ 0X5A2, "Мф., 90 зач., XXII, 15-22."}  //сб
+        },
+  std::array { ApEvReads{ 0X592, "Мф., 89 зач., XXII, 1–14."},  //Неделя 14
+          ApEvReads{ 0X103, "Мк., 16 зач., IV, 10–23."},  //пн - седмица 14
+          ApEvReads{ 0X113, "Мк., 17 зач., IV, 24–34."},  //вт
+          ApEvReads{ 0X123, "Мк., 18 зач., IV, 35–41."},  //ср
+          ApEvReads{ 0X133, "Мк., 19 зач., V, 1-20."},  //чт
+          ApEvReads{ 0X143, "Мк., 20 зач., V, 22–24, 35 – VI, 1."},  //пт
+          ApEvReads{ 0X5D2, "Мф., 93 зач., XXIII, 1–12."}  //сб
+        },
+  std::array { ApEvReads{ 0X5C2, "Мф., 92 зач., XXII, 35–46."},  //Неделя 15
+          ApEvReads{ 0X153, "Мк., 21 зач., V, 24–34."},  //пн - седмица 15
+          ApEvReads{ 0X163, "Мк., 22 зач., VI, 1-7."},  //вт
+          ApEvReads{ 0X173, "Мк., 23 зач., VI, 7–13."},  //ср
+          ApEvReads{ 0X193, "Мк., 25 зач., VI, 30–45."},  //чт
+          ApEvReads{ 0X1A3, "Мк., 26 зач., VI, 45–53."},  //пт
+          ApEvReads{ 0X612, "Мф., 97 зач., XXIV, 1–13."}  //сб
+        },
+  std::array { ApEvReads{ 0X692, "Мф., 105 зач., XXV, 14-30."},  //Неделя 16
+          ApEvReads{ 0X1B3, "Мк., 27 зач., VI, 54 - VII, 8."},  //пн - седмица 16
+          ApEvReads{ 0X1C3, "Мк., 28 зач., VII, 5-16."},  //вт
+          ApEvReads{ 0X1D3, "Мк., 29 зач., VII, 14–24."},  //ср
+          ApEvReads{ 0X1E3, "Мк., 30 зач., VII, 24–30."},  //чт
+          ApEvReads{ 0X203, "Мк., 32 зач., VIII, 1-10."},  //пт
+          ApEvReads{ 0X652, "Мф., 101 зач., XXIV, 34–44."}  //сб
+        },
+  std::array { ApEvReads{ 0X3E2, "Мф., 62 зач., XV, 21–28."},  //Неделя 17
+          ApEvReads{ 0X303, "Мк., 48 зач., X, 46–52."},  //пн - седмица 17
+          ApEvReads{ 0X323, "Мк., 50 зач., XI, 11–23."},  //вт
+          ApEvReads{ 0X333, "Мк., 51 зач., XI, 23–26."},  //ср
+          ApEvReads{ 0X343, "Мк., 52 зач., XI, 27–33."},  //чт
+          ApEvReads{ 0X353, "Мк., 53 зач., XII, 1–12."},  //пт
+          ApEvReads{ 0X682, "Мф., 104 зач., XXV, 1–13."}  //сб
+        },
+  std::array { ApEvReads{ 0X114, "Лк., 17 зач., V, 1–11."},  //Неделя 18
+          ApEvReads{ 0XA4, "Лк., 10 зач., III, 19–22."},  //пн - седмица 18
+          ApEvReads{ 0XB4, "Лк., 11 зач., III, 23 – IV, 1."},  //вт
+          ApEvReads{ 0XC4, "Лк., 12 зач., IV, 1-15."},  //ср
+          ApEvReads{ 0XD4, "Лк., 13 зач., IV, 16–22."},  //чт
+          ApEvReads{ 0XE4, "Лк., 14 зач., IV, 22–30."},  //пт
+          ApEvReads{ 0XF4, "Лк., 15 зач., IV, 31–36."}  //сб
+        },
+  std::array { ApEvReads{ 0X1A4, "Лк., 26 зач., VI, 31–36."},  //Неделя 19
+          ApEvReads{ 0X104, "Лк., 16 зач., IV, 37–44."},  //пн - седмица 19
+          ApEvReads{ 0X124, "Лк., 18 зач., V, 12-16."},  //вт
+          ApEvReads{ 0X154, "Лк., 21 зач., V, 33–39."},  //ср
+          ApEvReads{ 0X174, "Лк., 23 зач., VI, 12–19."},  //чт
+          ApEvReads{ 0X184, "Лк., 24 зач., VI, 17–23."},  //пт
+          ApEvReads{ 0X134, "Лк., 19 зач., V, 17–26."}  //сб
+        },
+  std::array { ApEvReads{ 0X1E4, "Лк., 30 зач., VII, 11–16."},  //Неделя 20
+          ApEvReads{ 0X194, "Лк., 25 зач., VI, 24–30."},  //пн - седмица 20
+          ApEvReads{ 0X1B4, "Лк., 27 зач., VI, 37–45."},  //вт
+          ApEvReads{ 0X1C4, "Лк., 28 зач., VI, 46 – VII, 1."},  //ср
+          ApEvReads{ 0X1F4, "Лк., 31 зач., VII, 17–30."},  //чт
+          ApEvReads{ 0X204, "Лк., 32 зач., VII, 31–35."},  //пт
+          ApEvReads{ 0X144, "Лк., 20 зач., V, 27–32."}  //сб
+        },
+  std::array { ApEvReads{ 0X234, "Лк., 35 зач., VIII, 5–15."},  //Неделя 21
+          ApEvReads{ 0X214, "Лк., 33 зач., VII, 36–50."},  //пн - седмица 21
+          ApEvReads{ 0X224, "Лк., 34 зач., VIII, 1–3."},  //вт
+          ApEvReads{ 0X254, "Лк., 37 зач., VIII, 22–25."},  //ср
+          ApEvReads{ 0X294, "Лк., 41 зач., IX, 7–11."},  //чт
+          ApEvReads{ 0X2A4, "Лк., 42 зач., IX, 12–18."},  //пт
+          ApEvReads{ 0X164, "Лк., 22 зач., VI, 1–10."}  //сб
+        },
+  std::array { ApEvReads{ 0X534, "Лк., 83 зач., XVI, 19–31."},  //Неделя 22
+          ApEvReads{ 0X2B4, "Лк., 43 зач., IX, 18–22."},  //пн - седмица 22
+          ApEvReads{ 0X2C4, "Лк., 44 зач., IX, 23-27."},  //вт
+          ApEvReads{ 0X2F4, "Лк., 47 зач., IX, 44–50."},  //ср
+          ApEvReads{ 0X304, "Лк., 48 зач., IX, 49–56."},  //чт
+          ApEvReads{ 0X324, "Лк., 50 зач., X, 1–15."},  //пт
+          ApEvReads{ 0X1D4, "Лк., 29 зач., VII, 1–10."}  //сб
+        },
+  std::array { ApEvReads{ 0X264, "Лк., 38 зач., VIII, 26–39."},  //Неделя 23
+          ApEvReads{ 0X344, "Лк., 52 зач., X, 22–24."},  //пн - седмица 23
+          ApEvReads{ 0X374, "Лк., 55 зач., XI, 1–10."},  //вт
+          ApEvReads{ 0X384, "Лк., 56 зач., XI, 9–13."},  //ср
+          ApEvReads{ 0X394, "Лк., 57 зач., XI, 14–23."},  //чт
+          ApEvReads{ 0X3A4, "Лк., 58 зач., XI, 23–26."},  //пт
+          ApEvReads{ 0X244, "Лк., 36 зач., VIII, 16–21."}  //сб
+        },
+  std::array { ApEvReads{ 0X274, "Лк., 39 зач., VIII, 41–56."},  //Неделя 24
+          ApEvReads{ 0X3B4, "Лк., 59 зач., XI, 29–33."},  //пн - седмица 24
+          ApEvReads{ 0X3C4, "Лк., 60 зач., XI, 34–41."},  //вт
+          ApEvReads{ 0X3D4, "Лк., 61 зач., XI, 42–46."},  //ср
+          ApEvReads{ 0X3E4, "Лк., 62 зач., XI, 47 – XII, 1."},  //чт
+          ApEvReads{ 0X3F4, "Лк., 63 зач., XII, 2–12."},  //пт
+          ApEvReads{ 0X284, "Лк., 40 зач., IX, 1–6."}  //сб
+        },
+  std::array { ApEvReads{ 0X354, "Лк., 53 зач., X, 25–37."},  //Неделя 25
+          ApEvReads{ 0X414, "Лк., 65 зач., XII, 13–15, 22–31."},  //пн - седмица 25
+          ApEvReads{ 0X444, "Лк., 68 зач., XII, 42–48."},  //вт
+          ApEvReads{ 0X454, "Лк., 69 зач., XII, 48-59."},  //ср
+          ApEvReads{ 0X464, "Лк., 70 зач., XIII, 1–9."},  //чт
+          ApEvReads{ 0X494, "Лк., 73 зач., XIII, 31–35."},  //пт
+          ApEvReads{ 0X2E4, "Лк., 46 зач., IX, 37–43."}  //сб
+        },
+  std::array { ApEvReads{ 0X424, "Лк., 66 зач., XII, 16–21."},  //Неделя 26
+          ApEvReads{ 0X4B4, "Лк., 75 зач., XIV, 12–15."},  //пн - седмица 26
+          ApEvReads{ 0X4D4, "Лк., 77 зач., XIV, 25–35."},  //вт
+          ApEvReads{ 0X4E4, "Лк., 78 зач., XV, 1–10."},  //ср
+          ApEvReads{ 0X504, "Лк., 80 зач., XVI, 1-9."},  //чт
+          ApEvReads{ 0X524, "Лк., 82 зач., XVI, 15–18; XVII, 1–4."},  //пт
+          ApEvReads{ 0X314, "Лк., 49 зач., IX, 57–62."}  //сб
+        },
+  std::array { ApEvReads{ 0X474, "Лк., 71 зач., XIII, 10–17."},  //Неделя 27
+          ApEvReads{ 0X564, "Лк., 86 зач., XVII, 20–25."},  //пн - седмица 27
+          ApEvReads{ 0X574, "Лк., 87 зач., XVII, 26–37."},  //вт
+          ApEvReads{ 0X5A4, "Лк., 90 зач., XVIII, 15–17, 26–30."},  //ср
+          ApEvReads{ 0X5C4, "Лк., 92 зач., XVIII, 31–34."},  //чт
+          ApEvReads{ 0X5F4, "Лк., 95 зач., XIX, 12–28."},  //пт
+          ApEvReads{ 0X334, "Лк., 51 зач., X, 16–21."}  //сб
+        },
+  std::array { ApEvReads{ 0X4C4, "Лк., 76 зач., XIV, 16–24."},  //Неделя 28
+          ApEvReads{ 0X614, "Лк., 97 зач., XIX, 37–44."},  //пн - седмица 28
+          ApEvReads{ 0X624, "Лк., 98 зач., XIX, 45–48."},  //вт
+          ApEvReads{ 0X634, "Лк., 99 зач., XX, 1–8."},  //ср
+          ApEvReads{ 0X644, "Лк., 100 зач., XX, 9–18."},  //чт
+          ApEvReads{ 0X654, "Лк., 101 зач., XX, 19-26."},  //пт
+          ApEvReads{ 0X434, "Лк., 67 зач., XII, 32–40."}  //сб
+        },
+  std::array { ApEvReads{ 0X554, "Лк., 85 зач., XVII, 12–19."},  //Неделя 29
+          ApEvReads{ 0X664, "Лк., 102 зач., XX, 27–44."},  //пн - седмица 29
+          ApEvReads{ 0X6A4, "Лк., 106 зач., XXI, 12–19."},  //вт
+          ApEvReads{ 0X684, "Лк., 104 зач., XXI, 5–7, 10–11, 20–24."},  //ср
+          ApEvReads{ 0X6B4, "Лк., 107 зач., XXI, 28–33."},  //чт
+          ApEvReads{ 0X6C4, "Лк., 108 зач., XXI, 37 – XXII, 8."},  //пт
+          ApEvReads{ 0X484, "Лк., 72 зач., XIII, 18–29."}  //сб
+        },
+  std::array { ApEvReads{ 0X5B4, "Лк., 91 зач., XVIII, 18-27."},  //Неделя 30
+          ApEvReads{ 0X213, "Мк., 33 зач., VIII, 11–21."},  //пн - седмица 30
+          ApEvReads{ 0X223, "Мк., 34 зач., VIII, 22–26."},  //вт
+          ApEvReads{ 0X243, "Мк., 36 зач., VIII, 30–34."},  //ср
+          ApEvReads{ 0X273, "Мк., 39 зач., IX, 10–16."},  //чт
+          ApEvReads{ 0X293, "Мк., 41 зач., IX, 33–41."},  //пт
+          ApEvReads{ 0X4A4, "Лк., 74 зач., XIV, 1–11."}  //сб
+        },
+  std::array { ApEvReads{ 0X5D4, "Лк., 93 зач., XVIII, 35-43."},  //Неделя 31
+          ApEvReads{ 0X2A3, "Мк., 42 зач., IX, 42 – X, 1."},  //пн - седмица 31
+          ApEvReads{ 0X2B3, "Мк., 43 зач., X, 2–12."},  //вт
+          ApEvReads{ 0X2C3, "Мк., 44 зач., X, 11–16."},  //ср
+          ApEvReads{ 0X2D3, "Мк., 45 зач., X, 17–27."},  //чт
+          ApEvReads{ 0X2E3, "Мк., 46 зач., X, 23–32."},  //пт
+          ApEvReads{ 0X514, "Лк., 81 зач., XVI, 10–15."}  //сб
+        },
+  std::array { ApEvReads{ 0X5E4, "Лк., 94 зач., XIX, 1-10."},  //Неделя 32
+          ApEvReads{ 0X303, "Мк., 48 зач., X, 46–52."},  //пн - седмица 32
+          ApEvReads{ 0X323, "Мк., 50 зач., XI, 11–23."},  //вт
+          ApEvReads{ 0X333, "Мк., 51 зач., XI, 23–26."},  //ср
+          ApEvReads{ 0X343, "Мк., 52 зач., XI, 27–33."},  //чт
+          ApEvReads{ 0X353, "Мк., 53 зач., XII, 1–12."},  //пт
+          ApEvReads{ 0X544, "Лк., 84 зач., XVII, 3–10."}  //сб
+        },
+  std::array { ApEvReads{ 0X594, "Лк., 89 зач., XVIII, 10–14."},  //Неделя 33 о мытари и фарисеи
+          ApEvReads{ 0X363, "Мк., 54 зач., XII, 13–17."},  //пн - седмица 33
+          ApEvReads{ 0X373, "Мк., 55 зач., XII, 18–27."},  //вт
+          ApEvReads{ 0X383, "Мк., 56 зач., XII, 28–37."},  //ср
+          ApEvReads{ 0X393, "Мк., 57 зач., XII, 38–44."},  //чт
+          ApEvReads{ 0X3A3, "Мк., 58 зач., XIII, 1–8."},  //пт
+          ApEvReads{ 0X584, "Лк., 88 зач., XVIII, 2–8."}  //сб
+        },
+  std::array { ApEvReads{ 0X4F4, "Лк., 79 зач., XV, 11–32."},  //Неделя 34 о блуднем сыне
+          ApEvReads{ 0X3B3, "Мк., 59 зач., XIII, 9–13."},  //пн - седмица 34
+          ApEvReads{ 0X3C3, "Мк., 60 зач., XIII, 14-23."},  //вт
+          ApEvReads{ 0X3D3, "Мк., 61 зач., XIII, 24–31."},  //ср
+          ApEvReads{ 0X3E3, "Мк., 62 зач., XIII, 31 – XIV, 2."},  //чт
+          ApEvReads{ 0X3F3, "Мк., 63 зач., XIV, 3-9."},  //пт
+          ApEvReads{ 0X674, "Лк., 103 зач., XX, 45 – XXI, 4."}  //сб
+        },
+  std::array { ApEvReads{ 0X6A2, "Мф., 106 зач., XXV, 31–46."},  //Неделя 35 мясопустная
+          ApEvReads{ 0X313, "Мк., 49 зач., XI, 1–11."},  //пн - седмица 35
+          ApEvReads{ 0X403, "Мк., 64 зач., XIV, 10–42."},  //вт
+          ApEvReads{ 0X413, "Мк., 65 зач., XIV, 43 – XV, 1."},  //ср
+          ApEvReads{ 0X423, "Мк., 66 зач., XV, 1–15."},  //чт
+          ApEvReads{ 0X443, "Мк., 68 зач., XV, 22, 25, 33–41."},  //пт
+          ApEvReads{ 0X694, "Лк., 105 зач., XXI, 8–9, 25–27, 33–36."}  //сб
+        },
+  std::array { ApEvReads{ 0X112, "Мф., 17 зач., VI, 14–21."},  //Неделя 36 сыропустная
+          ApEvReads{ 0X604, "Лк., 96 зач., XIX, 29–40; XXII, 7–39."},  //пн - седмица 36
+          ApEvReads{ 0X6D4, "Лк., 109 зач., XXII, 39–42, 45 – XXIII, 1."},  //вт
+          ApEvReads{},  //ср
+          ApEvReads{ 0X6E4, "Лк., 110 зач., XXIII, 1–34, 44–56."},  //чт
+          ApEvReads{},  //пт
+          ApEvReads{ 0X102, "Мф., 16 зач., VI, 1–13."}  //сб
+        }
+};
+//таблица рядовых чтений на литургии из приложения богосл.апостола. период от св. троицы до нед. сыропустная
+//двумерный массив [a][b], где а - календарный номер по пятидесятнице. b - деньнедели.
+constexpr TT1 apostol_table_1 {
+  std::array { ApEvReads{ 0X31, "Деян., 3 зач., II, 1–11."},  //неделя 0. день св. троицы
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{},
+          ApEvReads{}
+        },
+  std::array { ApEvReads{ 0X14A1, "Евр., 330 зач., XI, 33 – XII, 2."},  //Неделя 1 всех святых
+          ApEvReads{ 0XE51, "Еф., 229 зач., V, 8–19."},  //пн - Святаго Духа
+          ApEvReads{ 0X4F1, "Рим., 79 зач., I, 1–7, 13–17."},  //вт - седмица 1
+          ApEvReads{ 0X501, "Рим., 80 зач., I, 18–27."},  //ср
+          ApEvReads{ 0X511, "Рим., 81 зач., I, 28 – II, 9."},  //чт
+          ApEvReads{ 0X521, "Рим., 82 зач., II, 14–29."},  //пт
+          ApEvReads{ 0X4F1, "Рим., 79 зач., I, 7-12."}  //сб
+        },
+  std::array { ApEvReads{ 0X511, "Рим., 81 зач., II, 10-16."},  //Неделя 2
+          ApEvReads{ 0X531, "Рим., 83 зач., II, 28 – III, 18."},  //пн - седмица 2
+          ApEvReads{ 0X561, "Рим., 86 зач., IV, 4–12."},  //вт
+          ApEvReads{ 0X571, "Рим., 87 зач., IV, 13–25."},  //ср
+          ApEvReads{ 0X591, "Рим., 89 зач., V, 10–16."},  //чт
+          ApEvReads{ 0X5A1, "Рим., 90 зач., V, 17 – VI, 2."},  //пт
+          ApEvReads{ 0X541, "Рим., 84 зач., III, 19–26."}  //сб
+        },
+  std::array { ApEvReads{ 0X581, "Рим., 88 зач., V, 1–10."},  //Неделя 3
+          ApEvReads{ 0X5E1, "Рим., 94 зач., VII, 1–13."},  //пн - седмица 3
+          ApEvReads{ 0X5F1, "Рим., 95 зач., VII, 14 – VIII, 2."},  //вт
+          ApEvReads{ 0X601, "Рим., 96 зач., VIII, 2–13."},//ср
+          ApEvReads{ 0X621, "Рим., 98 зач., VIII, 22–27."},  //чт
+          ApEvReads{ 0X651, "Рим., 101 зач., IX, 6–19."},  //пт
+          ApEvReads{ 0X551, "Рим., 85 зач., III, 28 – IV, 3."}  //сб
+        },
+  std::array { ApEvReads{ 0X5D1, "Рим., 93 зач., VI, 18-23."},  //Неделя 4
+          ApEvReads{ 0X661, "Рим., 102 зач., IX, 18–33."},  //пн - седмица 4
+          ApEvReads{ 0X681, "Рим., 104 зач., X, 11 – XI, 2."},  //вт
+          ApEvReads{ 0X691, "Рим., 105 зач., XI, 2–12."},  //ср
+          ApEvReads{ 0X6A1, "Рим., 106 зач., XI, 13–24."},  //чт
+          ApEvReads{ 0X6B1, "Рим., 107 зач., XI, 25–36."},  //пт
+          ApEvReads{ 0X5C1, "Рим., 92 зач., VI, 11–17."}  //сб
+        },
+  std::array { ApEvReads{ 0X671, "Рим., 103 зач., X, 1–10."},  //Неделя 5
+          ApEvReads{ 0X6D1, "Рим., 109 зач., XII, 4–5, 15–21."},  //пн - седмица 5
+          ApEvReads{ 0X721, "Рим., 114 зач., XIV, 9–18."},  //вт
+          ApEvReads{ 0X751, "Рим., 117 зач., XV, 7–16."},  //ср
+          ApEvReads{ 0X761, "Рим., 118 зач., XV, 17–29."},  //чт
+          ApEvReads{ 0X781, "Рим., 120 зач., XVI, 1–16."},  //пт
+          ApEvReads{ 0X611, "Рим., 97 зач., VIII, 14–21."}  //сб
+        },
+  std::array { ApEvReads{ 0X6E1, "Рим., 110 зач., XII, 6–14."},  //Неделя 6
+          ApEvReads{ 0X791, "Рим., 121 зач., XVI, 17–24."},  //пн - седмица 6
+          ApEvReads{ 0X7A1, "1 Кор., 122 зач., I, 1–9."},  //вт
+          ApEvReads{ 0X7F1, "1 Кор., 127 зач., II, 9 – III, 8."},  //ср
+          ApEvReads{ 0X811, "1 Кор., 129 зач., III, 18–23."},  //чт
+          ApEvReads{ 0X821, "1 Кор., 130 зач., IV, 5-8."},  //пт
+          ApEvReads{ 0X641, "Рим., 100 зач., IX, 1–5."}  //сб
+        },
+  std::array { ApEvReads{ 0X741, "Рим., 116 зач., XV, 1–7."},  //Неделя 7
+          ApEvReads{ 0X861, "1 Кор., 134 зач., V, 9 – VI, 11."},  //пн - седмица 7
+          ApEvReads{ 0X881, "1 Кор., 136 зач., VI, 20 – VII, 12."},  //вт
+          ApEvReads{ 0X891, "1 Кор., 137 зач., VII, 12–24."},  //ср
+          ApEvReads{ 0X8A1, "1 Кор., 138 зач., VII, 24–35."},  //чт
+          ApEvReads{ 0X8B1, "1 Кор., 139 зач., VII, 35 – VIII, 7."},  //пт
+          ApEvReads{ 0X6C1, "Рим., 108 зач., XII, 1–3."}  //сб
+        },
+  std::array { ApEvReads{ 0X7C1, "1 Кор., 124 зач., I, 10–18."},  //Неделя 8
+          ApEvReads{ 0X8E1, "1 Кор., 142 зач., IX, 13–18."},  //пн - седмица 8
+          ApEvReads{ 0X901, "1 Кор., 144 зач., X, 5–12."},  //вт
+          ApEvReads{ 0X911, "1 Кор., 145 зач., X, 12–22."},  //ср
+          ApEvReads{ 0X931, "1 Кор., 147 зач., X, 28 – XI, 7."},  //чт
+          ApEvReads{ 0X941, "1 Кор., 148 зач., XI, 8–22."},  //пт
+          ApEvReads{ 0X6F1, "Рим., 111 зач., XIII, 1–10."}  //сб
+        },
+  std::array { ApEvReads{ 0X801, "1 Кор., 128 зач., III, 9–17."},  //Неделя 9
+          ApEvReads{ 0X961, "1 Кор., 150 зач., XI, 31 – XII, 6."},  //пн - седмица 9
+          ApEvReads{ 0X981, "1 Кор., 152 зач., XII, 12–26."},  //вт
+          ApEvReads{ 0X9A1, "1 Кор., 154 зач., XIII, 4 – XIV, 5."},//ср
+          ApEvReads{ 0X9B1, "1 Кор., 155 зач., XIV, 6–19."},  //чт
+          ApEvReads{ 0X9D1, "1 Кор., 157 зач., XIV, 26–40."},  //пт
+          ApEvReads{ 0X711, "Рим., 113 зач., XIV, 6–9."}  //сб
+        },
+  std::array { ApEvReads{ 0X831, "1 Кор., 131 зач., IV, 9–16."},  //Неделя 10
+          ApEvReads{ 0X9F1, "1 Кор., 159 зач., XV, 12–19."},  //пн - седмица 10
+          ApEvReads{ 0XA11, "1 Кор., 161 зач., XV, 29–38."},  //вт
+          ApEvReads{ 0XA51, "1 Кор., 165 зач., XVI, 4–12."},  //ср
+          ApEvReads{ 0XA71, "2 Кор., 167 зач., I, 1–7."},//чт
+          ApEvReads{ 0XA91, "2 Кор., 169 зач., I, 12–20."},  //пт
+          ApEvReads{ 0X771, "Рим., 119 зач., XV, 30–33."}  //сб
+        },
+  std::array { ApEvReads{ 0X8D1, "1 Кор., 141 зач., IX, 2–12."},  //Неделя 11
+          ApEvReads{ 0XAB1, "2 Кор., 171 зач., II, 3–15."},  //пн - седмица 11
+          ApEvReads{ 0XAC1, "2 Кор., 172 зач., II, 14 – III, 3."},  //вт
+          ApEvReads{ 0XAD1, "2 Кор., 173 зач., III, 4–11."},  //ср
+          ApEvReads{ 0XAF1, "2 Кор., 175 зач., IV, 1–6."},  //чт
+          ApEvReads{ 0XB11, "2 Кор., 177 зач., IV, 13–18."},  //пт
+          ApEvReads{ 0X7B1, "1 Кор., 123 зач., I, 3–9."}  //сб
+        },
+  std::array { ApEvReads{ 0X9E1, "1 Кор., 158 зач., XV, 1-11."},  //Неделя 12
+          ApEvReads{ 0XB31, "2 Кор., 179 зач., V, 10–15."},  //пн - седмица 12
+          ApEvReads{ 0XB41, "2 Кор., 180 зач., V, 15–21."},  //вт
+          ApEvReads{ 0XB61, "2 Кор., 182 зач., VI, 11–16."},  //ср
+          ApEvReads{ 0XB71, "2 Кор., 183 зач., VII, 1–10."},  //чт
+          ApEvReads{ 0XB81, "2 Кор., 184 зач., VII, 10–16."},  //пт
+          ApEvReads{ 0X7D1, "1 Кор., 125 зач., I, 18-24."}  //сб
+        },
+  std::array { ApEvReads{ 0XA61, "1 Кор., 166 зач., XVI, 13–24."},  //Неделя 13
+          ApEvReads{ 0XBA1, "2 Кор., 186 зач., VIII, 7–15."},  //пн - седмица 13
+          ApEvReads{ 0XBB1, "2 Кор., 187 зач., VIII, 16 – IX, 5."},  //вт
+          ApEvReads{ 0XBD1, "2 Кор., 189 зач., IX, 12 – X, 7."},  //ср
+          ApEvReads{ 0XBE1, "2 Кор., 190 зач., X, 7–18."},  //чт
+          ApEvReads{ 0XC01, "2 Кор., 192 зач., XI, 5–21."},  //пт
+          ApEvReads{ 0X7E1, "1 Кор., 126 зач., II, 6–9."}  //сб
+        },
+  std::array { ApEvReads{ 0XAA1, "2 Кор., 170 зач., I, 21 – II, 4."},  //Неделя 14
+          ApEvReads{ 0XC31, "2 Кор., 195 зач., XII, 10–19."},  //пн - седмица 14
+          ApEvReads{ 0XC41, "2 Кор., 196 зач., XII, 20 – XIII, 2."},  //вт
+          ApEvReads{ 0XC51, "2 Кор., 197 зач., XIII, 3–13."},  //ср
+          ApEvReads{ 0XC61, "Гал., 198 зач., I, 1–10, 20 – II, 5."},  //чт
+          ApEvReads{ 0XC91, "Гал., 201 зач., II, 6–10."},  //пт
+          ApEvReads{ 0X821, "1 Кор., 130 зач., IV, 1–5."}  //сб
+        },
+  std::array { ApEvReads{ 0XB01, "2 Кор., 176 зач., IV, 6–15."},  //Неделя 15
+          ApEvReads{ 0XCA1, "Гал., 202 зач., II, 11–16."},  //пн - седмица 15
+          ApEvReads{ 0XCC1, "Гал., 204 зач., II, 21 – III, 7."},  //вт
+          ApEvReads{ 0XCF1, "Гал., 207 зач., III, 15–22."},  //ср
+          ApEvReads{ 0XD01, "Гал., 208 зач., III, 23 - IV, 5."},  //чт
+          ApEvReads{ 0XD21, "Гал., 210 зач., IV, 8–21."},  //пт
+          ApEvReads{ 0X841, "1 Кор., 132 зач., IV, 17 – V, 5."}  //сб
+        },
+  std::array { ApEvReads{ 0XB51, "2 Кор., 181 зач., VI, 1–10."},  //Неделя 16
+          ApEvReads{ 0XD31, "Гал., 211 зач., IV, 28 – V, 10."},  //пн - седмица 16
+          ApEvReads{ 0XD41, "Гал., 212 зач., V, 11–21."},  //вт
+          ApEvReads{ 0XD61, "Гал., 214 зач., VI, 2–10."},  //ср
+          ApEvReads{ 0XD81, "Еф., 216 зач., I, 1–9."},  //чт
+          ApEvReads{ 0XD91, "Еф., 217 зач., I, 7–17."},  //пт
+          ApEvReads{ 0X921, "1 Кор., 146 зач., X, 23–28."}  //сб
+        },
+  std::array { ApEvReads{ 0XB61, "2 Кор., 182 зач., VI, 16 - VII, 1."},//Неделя 17
+          ApEvReads{ 0XDB1, "Еф., 219 зач., I, 22 – II, 3."},  //пн - седмица 17
+          ApEvReads{ 0XDE1, "Еф., 222 зач., II, 19 – III, 7."},  //вт
+          ApEvReads{ 0XDF1, "Еф., 223 зач., III, 8–21."},  //ср
+          ApEvReads{ 0XE11, "Еф., 225 зач., IV, 14–19."},  //чт
+          ApEvReads{ 0XE21, "Еф., 226 зач., IV, 17–25."},  //пт
+          ApEvReads{ 0X9C1, "1 Кор., 156 зач., XIV, 20–25."}  //сб
+        },
+  std::array { ApEvReads{ 0XBC1, "2 Кор., 188 зач., IX, 6–11."},  //Неделя 18
+          ApEvReads{ 0XE31, "Еф., 227 зач., IV, 25–32."},  //пн - седмица 18
+          ApEvReads{ 0XE61, "Еф., 230 зач., V, 20–26."},  //вт
+          ApEvReads{ 0XE71, "Еф., 231 зач., V, 25–33."},  //ср
+          ApEvReads{ 0XE81, "Еф., 232 зач., V, 33 – VI, 9."},  //чт
+          ApEvReads{ 0XEA1, "Еф., 234 зач., VI, 18–24."},  //пт
+          ApEvReads{ 0XA21, "1 Кор., 162 зач., XV, 39–45."}  //сб
+        },
+  std::array { ApEvReads{ 0XC21, "2 Кор., 194 зач., XI, 31 – XII, 9."},  //Неделя 19
+          ApEvReads{ 0XEB1, "Флп., 235 зач., I, 1–7."},  //пн - седмица 19
+          ApEvReads{ 0XEC1, "Флп., 236 зач., I, 8–14."},  //вт
+          ApEvReads{ 0XED1, "Флп., 237 зач., I, 12–20."},  //ср
+          ApEvReads{ 0XEE1, "Флп., 238 зач., I, 20–27."},  //чт
+          ApEvReads{ 0XEF1, "Флп., 239 зач., I, 27 – II, 4."},  //пт
+          ApEvReads{ 0XA41, "1 Кор., 164 зач., XV, 58 – XVI, 3."}  //сб
+        },
+  std::array { ApEvReads{ 0XC81, "Гал., 200 зач., I, 11–19."},  //Неделя 20
+          ApEvReads{ 0XF11, "Флп., 241 зач., II, 12–16."},  //пн - седмица 20
+          ApEvReads{ 0XF21, "Флп., 242 зач., II, 16–23."},  //вт
+          ApEvReads{ 0XF31, "Флп., 243 зач., II, 24–30."},  //ср
+          ApEvReads{ 0XF41, "Флп., 244 зач., III, 1–8."},  //чт
+          ApEvReads{ 0XF51, "Флп., 245 зач., III, 8–19."},  //пт
+          ApEvReads{ 0XA81, "2 Кор., 168 зач., I, 8–11."}  //сб
+        },
+  std::array { ApEvReads{ 0XCB1, "Гал., 203 зач., II, 16–20."},  //Неделя 21
+          ApEvReads{ 0XF81, "Флп., 248 зач., IV, 10–23."},  //пн - седмица 21
+          ApEvReads{ 0XF91, "Кол., 249 зач., I, 1–2, 7–11."},  //вт
+          ApEvReads{ 0XFB1, "Кол., 251 зач., I, 18–23."},  //ср
+          ApEvReads{ 0XFC1, "Кол., 252 зач., I, 24–29."},  //чт
+          ApEvReads{ 0XFD1, "Кол., 253 зач., II, 1–7."},  //пт
+          ApEvReads{ 0XAE1, "2 Кор., 174 зач., III, 12–18."}  //сб
+        },
+  std::array { ApEvReads{ 0XD71, "Гал., 215 зач., VI, 11–18."},  //Неделя 22
+          ApEvReads{ 0XFF1, "Кол., 255 зач., II, 13–20."},  //пн - седмица 22
+          ApEvReads{ 0X1001, "Кол., 256 зач., II, 20 – III, 3."},  //вт
+          ApEvReads{ 0X1031, "Кол., 259 зач., III, 17 – IV, 1."},  //ср
+          ApEvReads{ 0X1041, "Кол., 260 зач., IV, 2–9."},  //чт
+          ApEvReads{ 0X1051, "Кол., 261 зач., IV, 10–18."},  //пт
+          ApEvReads{ 0XB21, "2 Кор., 178 зач., V, 1–10."}  //сб
+        },
+  std::array { ApEvReads{ 0XDC1, "Еф., 220 зач., II, 4–10."},  //Неделя 23
+          ApEvReads{ 0X1061, "1 Сол., 262 зач., I, 1–5."},  //пн - седмица 23
+          ApEvReads{ 0X1071, "1 Сол., 263 зач., I, 6–10."},  //вт
+          ApEvReads{ 0X1081, "1 Сол., 264 зач., II, 1–8."},  //ср
+          ApEvReads{ 0X1091, "1 Сол., 265 зач., II, 9–14."},  //чт
+          ApEvReads{ 0X10A1, "1 Сол., 266 зач., II, 14–19."},  //пт
+          ApEvReads{ 0XB91, "2 Кор., 185 зач., VIII, 1–5."}  //сб
+        },
+  std::array { ApEvReads{ 0XDD1, "Еф., 221 зач., II, 14–22."},  //Неделя 24
+          ApEvReads{ 0X10B1, "1 Сол., 267 зач., II, 20 – III, 8."},  //пн - седмица 24
+          ApEvReads{ 0X10C1, "1 Сол., 268 зач., III, 9–13."},  //вт
+          ApEvReads{ 0X10D1, "1 Сол., 269 зач., IV, 1–12."},  //ср
+          ApEvReads{ 0X10F1, "1 Сол., 271 зач., V, 1–8."},  //чт
+          ApEvReads{ 0X1101, "1 Сол., 272 зач., V, 9–13, 24–28."},  //пт
+          ApEvReads{ 0XBF1, "2 Кор., 191 зач., XI, 1–6."}  //сб
+        },
+  std::array { ApEvReads{ 0XE01, "Еф., 224 зач., IV, 1–6."},  //Неделя 25
+          ApEvReads{ 0X1121, "2 Сол., 274 зач., I, 1–10."},  //пн - седмица 25
+          ApEvReads{ 0X1121, "2 Сол., 274 зач., I, 10 - II, 2."},  //вт
+          ApEvReads{ 0X1131, "2 Сол., 275 зач., II, 1–12."},  //ср
+          ApEvReads{ 0X1141, "2 Сол., 276 зач., II, 13 – III, 5."},  //чт
+          ApEvReads{ 0X1151, "2 Сол., 277 зач., III, 6–18."},  //пт
+          ApEvReads{ 0XC71, "Гал., 199 зач., I, 3–10."}  //сб
+        },
+  std::array { ApEvReads{ 0XE51, "Еф., 229 зач., V, 8–19."},  //Неделя 26
+          ApEvReads{ 0X1161, "1 Тим., 278 зач., I, 1–7."},  //пн - седмица 26
+          ApEvReads{ 0X1171, "1 Тим., 279 зач., I, 8–14."},  //вт
+          ApEvReads{ 0X1191, "1 Тим., 281 зач., I, 18–20; II, 8–15."},  //ср
+          ApEvReads{ 0X11B1, "1 Тим., 283 зач., III, 1–13."},  //чт
+          ApEvReads{ 0X11D1, "1 Тим., 285 зач., IV, 4–8, 16."},  //пт
+          ApEvReads{ 0XCD1, "Гал., 205 зач., III, 8–12."}  //сб
+        },
+  std::array { ApEvReads{ 0XE91, "Еф., 233 зач., VI, 10–17."},  //Неделя 27
+          ApEvReads{ 0X11D1, "1 Тим., 285 зач., V, 1-10."},  //пн - седмица 27
+          ApEvReads{ 0X11E1, "1 Тим., 286 зач., V, 11–21."},  //вт
+          ApEvReads{ 0X11F1, "1 Тим., 287 зач., V, 22 – VI, 11."},  //ср
+          ApEvReads{ 0X1211, "1 Тим., 289 зач., VI, 17–21."},  //чт
+          ApEvReads{ 0X1221, "2 Тим., 290 зач., I, 1–2, 8–18."},  //пт
+          ApEvReads{ 0XD51, "Гал., 213 зач., V, 22 – VI, 2."}  //сб
+        },
+  std::array { ApEvReads{ 0XFA1, "Кол., 250 зач., I, 12–18."},  //Неделя 28
+          ApEvReads{ 0X1261, "2 Тим., 294 зач., II, 20–26."},  //пн - седмица 28
+          ApEvReads{ 0X1291, "2 Тим., 297 зач., III, 16 – IV, 4."},  //вт
+          ApEvReads{ 0X12B1, "2 Тим., 299 зач., IV, 9–22."},  //ср
+          ApEvReads{ 0X12C1, "Тит., 300 зач., I, 5 - II, 1."},  //чт
+          ApEvReads{ 0X12D1, "Тит., 301 зач., I, 15 – II, 10."},  //пт
+          ApEvReads{ 0XDA1, "Еф., 218 зач., I, 16–23."}  //сб
+        },
+  std::array { ApEvReads{ 0X1011, "Кол., 257 зач., III, 4-11."},  //Неделя 29
+          ApEvReads{ 0X1341, "Евр., 308 зач., III, 5–11, 17–19."},  //пн - седмица 29
+          ApEvReads{ 0X1361, "Евр., 310 зач., IV, 1–13."},  //вт
+          ApEvReads{ 0X1381, "Евр., 312 зач., V, 11 – VI, 8."},  //ср
+          ApEvReads{ 0X13B1, "Евр., 315 зач., VII, 1–6."},  //чт
+          ApEvReads{ 0X13D1, "Евр., 317 зач., VII, 18–25."},  //пт
+          ApEvReads{ 0XDC1, "Еф., 220 зач., II, 11-13."}  //сб
+        },
+  std::array { ApEvReads{ 0X1021, "Кол., 258 зач., III, 12–16."},  //Неделя 30
+          ApEvReads{ 0X13F1, "Евр., 319 зач., VIII, 7–13."},  //пн - седмица 30
+          ApEvReads{ 0X1411, "Евр., 321 зач., IX, 8–10, 15–23."},  //вт
+          ApEvReads{ 0X1431, "Евр., 323 зач., X, 1–18."},  //ср
+          ApEvReads{ 0X1461, "Евр., 326 зач., X, 35 – XI, 7."},  //чт
+          ApEvReads{ 0X1471, "Евр., 327 зач., XI, 8, 11–16."},  //пт
+          ApEvReads{ 0XE41, "Еф., 228 зач., V, 1–8."}  //сб
+        },
+  std::array { ApEvReads{ 0X1181, "1 Тим., 280 зач., I, 15-17."},  //Неделя 31
+          ApEvReads{ 0X1491, "Евр., 329 зач., XI, 17–23, 27–31."},//пн - седмица 31
+          ApEvReads{ 0X14D1, "Евр., 333 зач., XII, 25–26; XIII, 22–25."},//вт
+          ApEvReads{ 0X321, "Иак., 50 зач., I, 1-18."},  //ср
+          ApEvReads{ 0X331, "Иак., 51 зач., I, 19-27."},  //чт
+          ApEvReads{ 0X341, "Иак., 52 зач., II, 1–13."},  //пт
+          ApEvReads{ 0XF91, "Кол., 249 зач., I, 3-6."}  //сб
+        },
+  std::array { ApEvReads{ 0X11D1, "1 Тим., 285 зач., IV, 9-15."},  //Неделя 32
+          ApEvReads{ 0X351, "Иак., 53 зач., II, 14–26."},  //пн - седмица 32
+          ApEvReads{ 0X361, "Иак., 54 зач., III, 1–10."},  //вт
+          ApEvReads{ 0X371, "Иак., 55 зач., III, 11 – IV, 6."},  //ср
+          ApEvReads{ 0X381, "Иак., 56 зач., IV, 7 – V, 9."},  //чт
+          ApEvReads{ 0X3A1, "1 Пет., 58 зач., I, 1–2, 10–12; II, 6–10."},//пт
+          ApEvReads{ 0X1111, "1 Сол., 273 зач., V, 14–23."}  //сб
+        },
+  std::array { ApEvReads{ 0X1281, "2 Тим., 296 зач., III, 10–15."},  //Неделя 33 о мытари и фарисеи
+          ApEvReads{ 0X3B1, "1 Пет., 59 зач., II, 21 – III, 9."},  //пн - седмица 33
+          ApEvReads{ 0X3C1, "1 Пет., 60 зач., III, 10–22."},  //вт
+          ApEvReads{ 0X3D1, "1 Пет., 61 зач., IV, 1–11."},  //ср
+          ApEvReads{ 0X3E1, "1 Пет., 62 зач., IV, 12 – V, 5."},  //чт
+          ApEvReads{ 0X401, "2 Пет., 64 зач., I, 1–10."},  //пт
+          ApEvReads{ 0X1251, "2 Тим., 293 зач., II, 11–19."}  //сб
+        },
+  std::array { ApEvReads{ 0X871, "1 Кор., 135 зач., VI, 12-20."},  //Неделя 34 о блуднем сыне
+          ApEvReads{ 0X421, "2 Пет., 66 зач., I, 20 – II, 9."},  //пн - седмица 34
+          ApEvReads{ 0X431, "2 Пет., 67 зач., II, 9–22."},  //вт
+          ApEvReads{ 0X441, "2 Пет., 68 зач., III, 1–18."},  //ср
+          ApEvReads{ 0X451, "1 Ин., 69 зач., I, 8 – II, 6."},  //чт
+          ApEvReads{ 0X461, "1 Ин., 70 зач., II, 7–17."},  //пт
+          ApEvReads{ 0X1271, "2 Тим., 295 зач., III, 1–9."}  //сб
+        },
+  std::array { ApEvReads{ 0X8C1, "1 Кор., 140 зач., VIII, 8 – IX, 2."},  //Неделя 35 мясопустная
+          ApEvReads{ 0X471, "1 Ин., 71 зач., II, 18 – III, 10."},  //пн - седмица 35
+          ApEvReads{ 0X481, "1 Ин., 72 зач., III, 10–20."},  //вт
+          ApEvReads{ 0X491, "1 Ин., 73 зач., III, 21 – IV, 6."},  //ср
+          ApEvReads{ 0X4A1, "1 Ин., 74 зач., IV, 20 – V, 21."},  //чт
+          ApEvReads{ 0X4B1, "2 Ин., 75 зач., I, 1–13."},  //пт
+          ApEvReads{ 0X921, "1 Кор., 146 зач., X, 23–28."}  //сб
+        },
+  std::array { ApEvReads{ 0X701, "Рим., 112 зач., XIII, 11 – XIV, 4."},  //Неделя 36 сыропустная
+          ApEvReads{ 0X4C1, "3 Ин., 76 зач., I, 1–15."},  //пн - седмица 36
+          ApEvReads{ 0X4D1, "Иуд., 77 зач., I, 1–10."},  //вт
+          ApEvReads{},  //ср
+          ApEvReads{ 0X4E1, "Иуд., 78 зач., I, 11–25."},  //чт
+          ApEvReads{},  //пт
+          ApEvReads{ 0X731, "Рим., 115 зач., XIV, 19–26."}  //сб
+        }
+};
+//таблица рядовых чтений на литургии из приложения богосл.евангелия. период от начала вел.поста до Троицкая суб.вкл.
+//массив пар, где first - константа-признак даты (блок 1 - переходящие дни года)
+constexpr auto evangelie_table_2 = std::to_array<TT2>({
+  {1,    { 0X15, "Ин., 1 зач., I, 1–17." } },//пасха
+  {2,    { 0X25, "Ин., 2 зач., I, 18–28." } },
+  {3,    { 0X714, "Лк., 113 зач., XXIV, 12–35."  } },
+  {4,    { 0X45, "Ин., 4 зач., I, 35–51." } },
+  {5,    { 0X85, "Ин., 8 зач., III, 1–15." } },
+  {6,    { 0X75, "Ин., 7 зач., II, 12–22." } },
+  {7,    { 0XB5, "Ин., 11 зач., III, 22–33." } },
+  {8,    { 0X415, "Ин., 65 зач., XX, 19–31." } },//Неделя 2, о Фоме
+  {9,    { 0X65, "Ин., 6 зач., II, 1–11." } },
+  {10,   { 0XA5, "Ин., 10 зач., III, 16–21." } },
+  {11,   { 0XF5, "Ин., 15 зач., V, 17–24." } },
+  {12,   { 0X105, "Ин., 16 зач., V, 24–30." } },
+  {13,   { 0X115, "Ин., 17 зач., V, 30 – VI, 2." } },
+  {14,   { 0X135, "Ин., 19 зач., VI, 14–27." } },
+  {15,   { 0X453, "Мк., 69 зач., XV, 43–47." } },//Неделя 3, о мироносицах
+  {16,   { 0XD5, "Ин., 13 зач., IV, 46–54." } },
+  {17,   { 0X145, "Ин., 20 зач., VI, 27–33." } },
+  {18,   { 0X155, "Ин., 21 зач., VI, 35–39." } },
+  {19,   { 0X165, "Ин., 22 зач., VI, 40–44." } },
+  {20,   { 0X175, "Ин., 23 зач., VI, 48–54." } },
+  {21,   { 0X345, "Ин., 52 зач., XV, 17 – XVI, 2." } },
+  {22,   { 0XE5, "Ин., 14 зач., V, 1–15." } },//Неделя 4, о разслабленнем
+  {23,   { 0X185, "Ин., 24 зач., VI, 56–69." } },
+  {24,   { 0X195, "Ин., 25 зач., VII, 1–13." } },
+  {25,   { 0X1A5, "Ин., 26 зач., VII, 14–30." } },
+  {26,   { 0X1D5, "Ин., 29 зач., VIII, 12–20." } },
+  {27,   { 0X1E5, "Ин., 30 зач., VIII, 21–30." } },
+  {28,   { 0X1F5, "Ин., 31 зач., VIII, 31–42." } },
+  {29,   { 0XC5, "Ин., 12 зач., IV, 5–42." } },//Неделя 5, о самаряныни
+  {30,   { 0X205, "Ин., 32 зач., VIII, 42–51." } },
+  {31,   { 0X215, "Ин., 33 зач., VIII, 51–59." } },
+  {32,   { 0X125, "Ин., 18 зач., VI, 5–14." } },
+  {33,   { 0X235, "Ин., 35 зач., IX, 39 – X, 9." } },
+  {34,   { 0X255, "Ин., 37 зач., X, 17–28." } },
+  {35,   { 0X265, "Ин., 38 зач., X, 27–38." } },
+  {36,   { 0X225, "Ин., 34 зач., IX, 1–38." } },//Неделя 6, о слепом
+  {37,   { 0X285, "Ин., 40 зач., XI, 47–57." } },
+  {38,   { 0X2A5, "Ин., 42 зач., XII, 19–36." } },
+  {39,   { 0X2B5, "Ин., 43 зач., XII, 36–47." } },
+  {40,   { 0X724, "Лк., 114 зач., XXIV, 36–53."  } },//Вознесение Господне
+  {41,   { 0X2F5, "Ин., 47 зач., XIV, 1–11." } },
+  {42,   { 0X305, "Ин., 48 зач., XIV, 10–21." } },
+  {43,   { 0X385, "Ин., 56 зач., XVII, 1–13." } },//Неделя 7, святых отец
+  {44,   { 0X315, "Ин., 49 зач., XIV, 27 – XV, 7." } },
+  {45,   { 0X355, "Ин., 53 зач., XVI, 2–13." } },
+  {46,   { 0X365, "Ин., 54 зач., XVI, 15–23." } },
+  {47,   { 0X375, "Ин., 55 зач., XVI, 23–33." } },
+  {48,   { 0X395, "Ин., 57 зач., XVII, 18–26." } },
+  {49,   { 0X435, "Ин., 67 зач., XXI, 15–25." } },
+  {92,   { 0XA3, "Мк., 10 зач., II, 23 – III, 5." } },//Суббота первая поста
+  {93,   { 0X55, "Ин., 5 зач., I, 43–51." } },//Неделя первая поста
+  {99,   { 0X63, "Мк., 6 зач., I, 35–44." } },//Суббота вторая поста
+  {100,  { 0X73, "Мк., 7 зач., II, 1–12." } },//Неделя вторая поста
+  {106,  { 0X83, "Мк., 8 зач., II, 14–17." } },//Суббота третия поста
+  {107,  { 0X253, "Мк., 37 зач., VIII, 34 – IX, 1." } },//Неделя третия поста
+  {113,  { 0X1F3, "Мк., 31 зач., VII, 31–37." } },//Суббота четвертая поста
+  {114,  { 0X283, "Мк., 40 зач., IX, 17–31." } },//Неделя четвертая постa
+  {120,  { 0X233, "Мк., 35 зач., VIII, 27–31." } },//Суббота пятая поста
+  {121,  { 0X2F3, "Мк., 47 зач., X, 32–45." } },//Неделя пятая поста
+  {127,  { 0X275, "Ин., 39 зач., XI, 1–45." } },//Суббота шестая Лазарева
+  {128,  { 0X295, "Ин., 41 зач., XII, 1–18." } },//В неделю цветоносную
+  {129,  { 0X622, "Мф., 98 зач., XXIV, 3–35." } },//великий Понедельник
+  {130,  { 0X662, "Мф., 102 зач., XXIV, 36 - XXVI, 2." } },//великий Вторник
+  {131,  { 0X6C2, "Мф., 108 зач., XXVI, 6-16." } },//великую Среду
+  {132,  { 0X6B2, "Мф., 107 зач., XXVI, 1–20. Ин., 44 зач., XIII, 3–17. Мф., 108 зач.(от полу́), XXVI, 21–39. Лк., 109 зач., XXII, 43–45. Мф., 108 зач., XXVI, 40 – XXVII, 2." } },//великий Четверток
+  {134,  { 0X732, "Мф., 115 зач., XXVIII, 1–20." } } //великую Субботу
+});
+//таблица рядовых чтений на литургии из приложения богосл.апостола. период от начала вел.поста до Троицкая суб.вкл.
+//массив пар, где first - константа-признак даты (блок 1 - переходящие дни года)
+constexpr auto apostol_table_2 = std::to_array<TT2>({
+  {1,    { 0X11, "Деян., 1 зач., I, 1–8." } },   //пасха
+  {2,    { 0X21, "Деян., 2 зач., I, 12–17, 21–26." } },
+  {3,    { 0X41, "Деян., 4 зач., II, 14–21." } },
+  {4,    { 0X51, "Деян., 5 зач., II, 22–36." } },
+  {5,    { 0X61, "Деян., 6 зач., II, 38–43." } },
+  {6,    { 0X71, "Деян., 7 зач., III, 1–8." } },
+  {7,    { 0X81, "Деян., 8 зач., III, 11–16." } },
+  {8,    { 0XE1, "Деян., 14 зач., V, 12–20." } },//Неделя 2, о Фоме
+  {9,    { 0X91, "Деян., 9 зач., III, 19–26." } },
+  {10,   { 0XA1, "Деян., 10 зач., IV, 1–10." } },
+  {11,   { 0XB1, "Деян., 11 зач., IV, 13–22." } },
+  {12,   { 0XC1, "Деян., 12 зач., IV, 23–31." } },
+  {13,   { 0XD1, "Деян., 13 зач., V, 1–11." } },
+  {14,   { 0XF1, "Деян., 15 зач., V, 21–33." } },
+  {15,   { 0X101, "Деян., 16 зач., VI, 1-7." } },//Неделя 3, о мироносицах
+  {16,   { 0X111, "Деян., 17 зач., VI, 8 – VII, 5, 47–60." } },
+  {17,   { 0X121, "Деян., 18 зач., VIII, 5–17." } },
+  {18,   { 0X131, "Деян., 19 зач., VIII, 18–25." } },
+  {19,   { 0X141, "Деян., 20 зач., VIII, 26–39." } },
+  {20,   { 0X151, "Деян., 21 зач., VIII, 40 – IX, 19." } },
+  {21,   { 0X161, "Деян., 22 зач., IX, 19–31." } },
+  {22,   { 0X171, "Деян., 23 зач., IX, 32-42." } },//Неделя 4, о разслабленнем
+  {23,   { 0X181, "Деян., 24 зач., X, 1–16." } },
+  {24,   { 0X191, "Деян., 25 зач., X, 21–33." } },
+  {25,   { 0X221, "Деян., 34 зач., XIV, 6–18." } },
+  {26,   { 0X1A1, "Деян., 26 зач., X, 34–43." } },
+  {27,   { 0X1B1, "Деян., 27 зач., X, 44 – XI, 10." } },
+  {28,   { 0X1D1, "Деян., 29 зач., XII, 1–11." } },
+  {29,   { 0X1C1, "Деян., 28 зач., XI, 19–26, 29–30." } },//Неделя 5, о самаряныни
+  {30,   { 0X1E1, "Деян., 30 зач., XII, 12–17." } },
+  {31,   { 0X1F1, "Деян., 31 зач., XII, 25 – XIII, 12." } },
+  {32,   { 0X201, "Деян., 32 зач., XIII, 13–24." } },
+  {33,   { 0X231, "Деян., 35 зач., XIV, 20–27." } },
+  {34,   { 0X241, "Деян., 36 зач., XV, 5–34." } },
+  {35,   { 0X251, "Деян., 37 зач., XV, 35–41." } },
+  {36,   { 0X261, "Деян., 38 зач., XVI, 16–34." } },//Неделя 6, о слепом
+  {37,   { 0X271, "Деян., 39 зач., XVII, 1–15." } },
+  {38,   { 0X281, "Деян., 40 зач., XVII, 19-28." } },
+  {39,   { 0X291, "Деян., 41 зач., XVIII, 22–28." } },
+  {40,   { 0X11, "Деян., 1 зач., I, 1–12." } },//Вознесение Господне
+  {41,   { 0X2A1, "Деян., 42 зач., XIX, 1–8." } },
+  {42,   { 0X2B1, "Деян., 43 зач., XX, 7–12." } },
+  {43,   { 0X2C1, "Деян., 44 зач., XX, 16-18, 28-36." } },//Неделя 7, святых отец
+  {44,   { 0X2D1, "Деян., 45 зач., XXI, 8–14." } },
+  {45,   { 0X2E1, "Деян., 46 зач., XXI, 26–32." } },
+  {46,   { 0X2F1, "Деян., 47 зач., XXIII, 1–11." } },
+  {47,   { 0X301, "Деян., 48 зач., XXV, 13–19." } },
+  {48,   { 0X321, "Деян., 50 зач., XXVII, 1–44." } },
+  {49,   { 0X331, "Деян., 51 зач., XXVIII, 1–31." } },
+  {92,   { 0X12F1, "Евр., 303 зач., I, 1–12." } },//Суббота первая поста
+  {93,   { 0X1491, "Евр., 329 зач., XI, 24-26, 32 - XII, 2." } },//Неделя первая поста
+  {99,   { 0X1351, "Евр., 309 зач., III, 12–16." } },//Суббота вторая поста
+  {100,  { 0X1301, "Евр., 304 зач., I, 10 – II, 3." } },//Неделя вторая поста
+  {106,  { 0X1451, "Евр., 325 зач., X, 32–38." } },//Суббота третия поста
+  {107,  { 0X1371, "Евр., 311 зач., IV, 14 – V, 6." } },//Неделя третия поста
+  {113,  { 0X1391, "Евр., 313 зач., VI, 9–12." } },//Суббота четвертая поста
+  {114,  { 0X13A1, "Евр., 314 зач., VI, 13–20." } },//Неделя четвертая постa
+  {120,  { 0X1421, "Евр., 322 зач., IX, 24–28." } },//Суббота пятая поста
+  {121,  { 0X1411, "Евр., 321 зач., IX, 11-14." } },//Неделя пятая поста
+  {127,  { 0X14D1, "Евр., 333 зач., XII, 28 - XIII, 8." } },//Суббота шестая Лазарева
+  {128,  { 0XF71, "Флп., 247 зач., IV, 4-9." } },//В неделю цветоносную
+  {132,  { 0X951, "1 Кор., 149 зач., XI, 23–32." } },//великий Четверток
+  {134,  { 0X5B1, "Рим., 91 зач., VI, 3–11." } }//великую Субботу
+});
+//проверка упорядоченности таблиц и отсутствия повторов констант-признаков
+constexpr bool is_strictly_sorted(std::span<const TT2> t)
+{
+  return std::adjacent_find(t.begin(), t.end(), [](const auto& a, const auto& b){ return a.first>=b.first; }) == t.end();
+}
+static_assert(is_strictly_sorted(evangelie_table_2));
+static_assert(is_strictly_sorted(apostol_table_2));
+//плотные индексы таблиц: элемент [m] - позиция+1 чтения для константы-признака m в таблице (0 - нет чтения)
+constexpr std::size_t TABLE2_INDEX_SIZE = std::max(evangelie_table_2.back().first, apostol_table_2.back().first) + 1;
+template<std::size_t N>
+  constexpr std::array<uint8_t, TABLE2_INDEX_SIZE> make_table2_index(const std::array<TT2, N>& t)
+{
+  static_assert(N < 256);
+  std::array<uint8_t, TABLE2_INDEX_SIZE> res{};
+  for(std::size_t i=0; i<N; i++) res[t[i].first] = static_cast<uint8_t>(i+1);
+  return res;
+}
+constexpr auto evangelie_table2_index = make_table2_index(evangelie_table_2);
+constexpr auto apostol_table2_index = make_table2_index(apostol_table_2);
+//функц.поиск чтения по константе-признаку в плоской таблице
+const ApEvReads* find_in_table2(std::span<const TT2> t, std::span<const uint8_t> index, uint16_t marker)
+{
+  if(marker>=index.size() || index[marker]==0) return nullptr;
+  return &t[index[marker]-1].second;
+}
+
+//таблица 11-и воскресныx утрених евангелий
+constexpr std::array resurrect_evangelie_table = {
+  ApEvReads{ 0X742,  "Мф., 116 зач., XXVIII, 16–20." },
+  ApEvReads{ 0X463 , "Мк., 70 зач., XVI, 1–8." },
+  ApEvReads{ 0X473 , "Мк., 71 зач., XVI, 9–20." },
+  ApEvReads{ 0X704,  "Лк., 112 зач., XXIV, 1–12." },
+  ApEvReads{ 0X714,  "Лк., 113 зач., XXIV, 12–35." },
+  ApEvReads{ 0X724,  "Лк., 114 зач., XXIV, 36–53." },
+  ApEvReads{ 0X3f5 , "Ин., 63 зач., XX, 1–10." },
+  ApEvReads{ 0X405 , "Ин., 64 зач., XX, 11–18." },
+  ApEvReads{ 0X415 , "Ин., 65 зач., XX, 19–31." },
+  ApEvReads{ 0X425 , "Ин., 66 зач., XXI, 1–14." },
+  ApEvReads{ 0X435 , "Ин., 67 зач., XXI, 15–25." }
+};
+//таблица праздничных утрених евангелий
+constexpr std::array holydays_evangelie_table = {
+  ApEvReads{ 0X532, "Мф., 83 зач., XXI, 1–11, 15–17." },//Вербное воскресенье
+  ApEvReads{ 0X23,  "Мк., 2 зач., I, 9–11." },          //Крещение
+  ApEvReads{ 0X84,  "Лк., 8 зач., II, 25–32."},         //Сре́тение
+  ApEvReads{ 0X44,  "Лк., 4 зач., I, 39–49, 56."},      //Благовещ́ение, Успе́ние, Рождество, Введе́ние Пресв.Богородицы
+  ApEvReads{ 0X2d4, "Лк., 45 зач., IX, 28–36."},        //Преображение
+  ApEvReads{ 0X2a5, "Ин., 42 зач., XII, 28-36."},       //Воздви́жение
+  ApEvReads{ 0X22,  "Мф., 2 зач., I, 18–25."}           //Рождество
+};
+//константы-признаки дней с особым утренним евангелием
+constexpr std::array unique_evangelie_table = {
+  ned2_popashe,
+  ned3_popashe,
+  ned4_popashe,
+  ned5_popashe,
+  ned6_popashe,
+  ned7_popashe,
+  ned8_popashe,
+  vel_post_d0n7,
+  m1d6,
+  sretenie,
+  m3d25,
+  m8d6,
+  m8d15,
+  m9d8,
+  m9d14,
+  m11d21,
+  m12d25
+};
+//идентификатор чтения в таблицах выше (0 - чтение отсутствует):
+//старшие 4 бита - номер таблицы, младшие 12 бит - индекс в таблице.
+constexpr uint16_t READS_EV1 = 0x1000;//evangelie_table_1, индекс = n50*7+dn
+constexpr uint16_t READS_AP1 = 0x2000;//apostol_table_1, индекс = n50*7+dn
+constexpr uint16_t READS_EV2 = 0x3000;//evangelie_table_2, индекс = константа-признак
+constexpr uint16_t READS_AP2 = 0x4000;//apostol_table_2, индекс = константа-признак
+constexpr uint16_t READS_RES = 0x5000;//resurrect_evangelie_table
+constexpr uint16_t READS_HOL = 0x6000;//holydays_evangelie_table
+
+ApEvReads reading_by_id(uint16_t id)
+{
+  const uint16_t i = id & 0x0FFF;
+  switch(id & 0xF000) {
+    case READS_EV1: { return evangelie_table_1.at(i/7).at(i%7); }
+    case READS_AP1: { return apostol_table_1.at(i/7).at(i%7); }
+    case READS_EV2: {
+      if(auto fr = find_in_table2(evangelie_table_2, evangelie_table2_index, i); fr) return *fr;
+    } break;
+    case READS_AP2: {
+      if(auto fr = find_in_table2(apostol_table_2, apostol_table2_index, i); fr) return *fr;
+    } break;
+    case READS_RES: { return resurrect_evangelie_table.at(i); }
+    case READS_HOL: { return holydays_evangelie_table.at(i); }
+    default: {}
+  };
+  return {};
+}
+
+/*----------------------------------------------*/
+/*              stable dates tables             */
+/*----------------------------------------------*/
+
+//таблица - непереходящие даты года
+constexpr std::array stable_dates = {
+  (int)m1d1, 1, 1,
+  (int)m1d2, 1, 2,
+  (int)m1d3, 1, 3,
+  (int)m1d4, 1, 4,
+  (int)m1d5, 1, 5,
+  (int)m1d6, 1, 6,
+  (int)m1d7, 1, 7,
+  (int)m1d8, 1, 8,
+  (int)m1d9, 1, 9,
+  (int)m1d10, 1, 10,
+  (int)m1d11, 1, 11,
+  (int)m1d12, 1, 12,
+  (int)m1d13, 1, 13,
+  (int)m1d14, 1, 14,
+  (int)m3d25, 3, 25,
+  (int)m6d24, 6, 24,
+  (int)m6d25, 6, 25,
+  (int)m6d29, 6, 29,
+  (int)m8d5, 8, 5,
+  (int)m8d6, 8, 6,
+  (int)m8d7, 8, 7,
+  (int)m8d8, 8, 8,
+  (int)m8d9, 8, 9,
+  (int)m8d10, 8, 10,
+  (int)m8d11, 8, 11,
+  (int)m8d12, 8, 12,
+  (int)m8d13, 8, 13,
+  (int)m8d14, 8, 14,
+  (int)m8d15, 8, 15,
+  (int)m8d16, 8, 16,
+  (int)m8d17, 8, 17,
+  (int)m8d18, 8, 18,
+  (int)m8d19, 8, 19,
+  (int)m8d20, 8, 20,
+  (int)m8d21, 8, 21,
+  (int)m8d22, 8, 22,
+  (int)m8d23, 8, 23,
+  (int)m9d7, 9, 7,
+  (int)m9d8, 9, 8,
+  (int)m9d9, 9, 9,
+  (int)m9d10, 9, 10,
+  (int)m9d11, 9, 11,
+  (int)m9d12, 9, 12,
+  (int)m9d13, 9, 13,
+  (int)m9d14, 9, 14,
+  (int)m9d15, 9, 15,
+  (int)m9d16, 9, 16,
+  (int)m9d17, 9, 17,
+  (int)m9d18, 9, 18,
+  (int)m9d19, 9, 19,
+  (int)m9d20, 9, 20,
+  (int)m9d21, 9, 21,
+  (int)m8d29, 8, 29,
+  (int)m10d1, 10, 1,
+  (int)m11d20, 11, 20,
+  (int)m11d21, 11, 21,
+  (int)m11d22, 11, 22,
+  (int)m11d23, 11, 23,
+  (int)m11d24, 11, 24,
+  (int)m11d25, 11, 25,
+  (int)m12d20, 12, 20,
+  (int)m12d21, 12, 21,
+  (int)m12d22, 12, 22,
+  (int)m12d23, 12, 23,
+  (int)m12d24, 12, 24,
+  (int)m12d25, 12, 25,
+  (int)m12d26, 12, 26,
+  (int)m12d27, 12, 27,
+  (int)m12d28, 12, 28,
+  (int)m12d29, 12, 29,
+  (int)m12d30, 12, 30,
+  (int)m12d31, 12, 31
+};
+
+//таблица - даты сплошных седмиц (святки)
+constexpr std::array svyatki_dates = {
+  ShortDate{1,1},
+  ShortDate{1,2},
+  ShortDate{1,3},
+  ShortDate{1,4},
+  ShortDate{12,25},
+  ShortDate{12,26},
+  ShortDate{12,27},
+  ShortDate{12,28},
+  ShortDate{12,29},
+  ShortDate{12,30},
+  ShortDate{12,31}
+};
+
+/*----------------------------------------------*/
+/*            markers compact index             */
+/*----------------------------------------------*/
+
+//блоки констант-признаков: первая и последняя константа каждого блока
+constexpr std::array<std::pair<uint16_t, uint16_t>, 7> markers_blocks {{
+  {pasha,             vel_post_d6n7},
+  {m1d1,              m12d31},
+  {sub_peredbogoyav,  sobor_vsehsv_rus},
+  {dvana10_per_prazd, vel_prazd},
+  {post_vel,          full7_troica},
+  {mari_icon_01,      mari_icon_25},
+  {sobor_valaam,      sobor_german}
+}};
+
+//функц.возвращает компактный номер константы-признака (0..MARKERS_COUNT-1) или -1
+constexpr int marker_index(uint16_t m)
+{
+  int base{};
+  for(auto [first, last]: markers_blocks) {
+    if(m>=first && m<=last) return base + (m - first);
+    base += last - first + 1;
+  }
+  return -1;
+}
+
+//общее кол-во констант-признаков
+constexpr int MARKERS_COUNT = marker_index(sobor_german) + 1;
+static_assert(MARKERS_COUNT == 318);
+
+/*----------------------------------------------*/
+/*             class CacheMetrics               */
+/*----------------------------------------------*/
+
+//счетчики и гистограммы хранилища годов; разделяются хранилищем и
+//построенными в нем объектами OrthYear (для учета ленивых фаз)
+class CacheMetrics {
+  static constexpr auto PHASES_COUNT = CacheStats::PHASES_COUNT;
+  static constexpr auto HIST_SIZE = CacheStats::HIST_SIZE;
+  std::atomic<uint64_t> hits{};
+  std::atomic<uint64_t> misses{};
+  std::atomic<uint64_t> evictions{};
+  std::atomic<uint64_t> clears{};
+  std::array<std::atomic<uint64_t>, PHASES_COUNT> builds{};
+  std::array<std::atomic<uint64_t>, PHASES_COUNT> build_time_ns{};
+  std::array<std::array<std::atomic<uint64_t>, HIST_SIZE>, PHASES_COUNT> build_time_hist{};
+  std::atomic<bool> has_hook{};
+  std::atomic<std::shared_ptr<const CacheHook>> hook;//чтение без блокировки мьютекса на пути попадания в кэш
+
+  void notify_(const CacheEventInfo& e) const;
+
+public:
+  void hit() { hits.fetch_add(1, std::memory_order_relaxed); notify_({CacheEvent::hit, 1, {}, {}}); }
+  void miss() { misses.fetch_add(1, std::memory_order_relaxed); notify_({CacheEvent::miss, 1, {}, {}}); }
+  void evicted(std::size_t n);
+  void cleared(std::size_t n);
+  void built(BuildPhase phase, std::chrono::nanoseconds duration);
+  void set_hook(CacheHook h);
+  void fill(CacheStats& s) const;
+};
+
+void CacheMetrics::notify_(const CacheEventInfo& e) const
+{
+  if(!has_hook.load(std::memory_order_acquire)) return;
+  const auto h = hook.load(std::memory_order_acquire);
+  if(!h) return;
+  try { (*h)(e); }
+  catch(...) {}//исключения обработчика не должны нарушать работу кэша
+}
+
+void CacheMetrics::evicted(std::size_t n)
+{
+  if(!n) return;
+  evictions.fetch_add(n, std::memory_order_relaxed);
+  notify_({CacheEvent::eviction, n, {}, {}});
+}
+
+void CacheMetrics::cleared(std::size_t n)
+{
+  clears.fetch_add(1, std::memory_order_relaxed);
+  notify_({CacheEvent::clear, n, {}, {}});
+}
+
+void CacheMetrics::built(BuildPhase phase, std::chrono::nanoseconds duration)
+{
+  const auto i = static_cast<std::size_t>(phase);
+  const auto us = static_cast<uint64_t>(std::max<int64_t>(0, duration.count()) / 1000);
+  const auto bucket = std::min<std::size_t>(HIST_SIZE-1, std::bit_width(us));
+  builds[i].fetch_add(1, std::memory_order_relaxed);
+  build_time_ns[i].fetch_add(static_cast<uint64_t>(std::max<int64_t>(0, duration.count())), std::memory_order_relaxed);
+  build_time_hist[i][bucket].fetch_add(1, std::memory_order_relaxed);
+  notify_({CacheEvent::build, 1, phase, duration});
+}
+
+void CacheMetrics::set_hook(CacheHook h)
+{
+  std::shared_ptr<const CacheHook> x = h ? std::make_shared<const CacheHook>(std::move(h)) : nullptr;
+  const bool b = static_cast<bool>(x);
+  hook.store(std::move(x), std::memory_order_release);
+  has_hook.store(b, std::memory_order_release);
+}
+
+void CacheMetrics::fill(CacheStats& s) const
+{
+  s.hits = hits.load(std::memory_order_relaxed);
+  s.misses = misses.load(std::memory_order_relaxed);
+  s.evictions = evictions.load(std::memory_order_relaxed);
+  s.clears = clears.load(std::memory_order_relaxed);
+  for(std::size_t i=0; i<PHASES_COUNT; i++) {
+    s.builds[i] = builds[i].load(std::memory_order_relaxed);
+    s.build_time_ns[i] = build_time_ns[i].load(std::memory_order_relaxed);
+    for(std::size_t j=0; j<HIST_SIZE; j++) s.build_time_hist[i][j] = build_time_hist[i][j].load(std::memory_order_relaxed);
+  }
+}
+
 /*----------------------------------------------*/
 /*              class OrthYear                  */
 /*----------------------------------------------*/
 
 class OrthYear {
 
-  ShortDate pasha_calc(const big_int& year)
+  static ShortDate pasha_calc(const big_int& year)
   { //use Gauss method for julian calendar
     int8_t m_=3, p;
     unsigned a, b, c, d, e;
@@ -1202,78 +2293,101 @@ class OrthYear {
     return std::make_pair(m_, p);
   }
 
-  struct Data1 {
+  static bool is_visokos(const big_int& y) { return (y%4)==0; }
+  static int8_t get_days_inmonth_(int8_t month, bool leap);
+  static ShortDate increment_date_(ShortDate date, int days, bool visokos);
+  static ShortDate decrement_date_(ShortDate date, int days, bool visokos);
+  static std::optional<std::map<ShortDate, int8_t>> create_days_map_(const big_int& y);
+  static int day_of_year_(const ShortDate& d, bool leap);
+  static ShortDate date_of_year_(int k, bool leap);
+
+  struct DayHot {//часто запрашиваемые данные дня
     int8_t dn{-1};
     int8_t glas{-1};
     int8_t n50{-1};
-    int8_t day{};
-    int8_t month{};
-    ApEvReads apostol;
-    ApEvReads evangelie;
-    std::array<uint16_t, M_COUNT> day_markers{};//sorted array
-    bool operator<(const Data1& rhs) const
-    {
-      return ShortDate{month, day} < ShortDate{rhs.month, rhs.day};
-    }
-    bool operator==(const Data1& rhs) const = default;
-    bool operator<(const ShortDate& rhs) const
-    {
-      return ShortDate{month, day} < rhs;
-    }
-    bool operator==(const ShortDate& rhs) const
-    {
-      return ShortDate{month, day} == rhs;
-    }
   };
 
-  struct Data2 {
-    uint16_t marker{};
-    int8_t day{};
-    int8_t month{};
-    bool operator<(const Data2& rhs) const
-    {
-      return marker < rhs.marker;
-    }
-    bool operator==(const Data2& rhs) const = default;
-    bool operator<(oxc_const rhs) const
-    {
-      return marker < rhs;
-    }
-    bool operator==(oxc_const rhs) const
-    {
-      return marker == rhs;
-    }
-    friend bool operator<(oxc_const lhs, const Data2& rhs)
-    {
-      return lhs < rhs.marker;
-    }
+  struct DayCold {//чтения дня, идентификаторы для reading_by_id()
+    uint16_t apostol{};
+    uint16_t evangelie{};
+    uint16_t resurrect{};//воскресное утреннее евангелие
   };
 
-  std::vector<Data1> data1;//sorted array
-  std::vector<Data2> data2;//sorted array
-  int8_t winter_indent;
-  int8_t spring_indent;
+  //массивы по дням года, индекс - порядковый номер дня (см. day_of_year_)
+  //поля glas, n50 и чтения заполняются лениво (см. build_*_)
+  mutable std::array<DayHot, 366> days_hot;
+  mutable std::array<DayCold, 366> days_cold;
+  std::array<uint16_t, 367> markers_offs{};//признаки дня k: markers_pool[markers_offs[k]..markers_offs[k+1])
+  std::vector<uint16_t> markers_pool;//sorted по каждому дню
+  //дни с признаком i (i - см. marker_index): dates_pool[dates_offs[i]..dates_offs[i+1])
+  std::array<uint16_t, MARKERS_COUNT+1> dates_offs{};
+  std::vector<uint16_t> dates_pool;//sorted по каждому признаку
+  mutable int8_t winter_indent;
+  mutable int8_t spring_indent;
+  mutable int8_t spring_indent_prev;//осенняя отступка/преступка пред. года
   big_int y;
+  bool visokos;
+  std::array<uint8_t,17> indent_opts;//параметры отступки/преступки чтений
+  bool osen_otstupka_apostol;
+  //флаги однократного вычисления фаз
+  mutable std::once_flag glas_flag;
+  mutable std::once_flag n50_flag;
+  mutable std::once_flag readings_flag;
+  std::shared_ptr<CacheMetrics> metrics;//учет времени вычисления фаз (может отсутствовать)
+
+  void build_glas_() const;
+  void build_n50_() const;
+  void build_readings_() const;
+  void run_phase_(BuildPhase phase, void (OrthYear::*build)() const) const;
+  void require_glas_() const
+  {
+    std::call_once(glas_flag, &OrthYear::run_phase_, this, BuildPhase::glas, &OrthYear::build_glas_);
+  }
+  void require_n50_() const
+  {
+    std::call_once(n50_flag, &OrthYear::run_phase_, this, BuildPhase::n50, &OrthYear::build_n50_);
+  }
+  void require_readings_() const
+  {
+    std::call_once(readings_flag, &OrthYear::run_phase_, this, BuildPhase::readings, &OrthYear::build_readings_);
+  }
+  int8_t get_dn_prev_year_(const ShortDate& d) const;
+
+  //битовое множество дней года: бит k - день с порядковым номером k (см. day_of_year_)
+  using DaySet = std::array<uint64_t, 6>;
+  DaySet all_days_() const;
+  DaySet days_with_(oxc_const m) const;
+  DaySet days_of_weekday_(int8_t wd) const;
+  DaySet eval_query_(const PropertyQuery& q) const;
+  std::optional<std::vector<ShortDate>> dates_of_(const DaySet& x) const;
 
-  std::optional<decltype(data1)::const_iterator> find_in_data1(int8_t m, int8_t d) const
+  std::span<const uint16_t> day_markers_(int k) const
   {
-    auto dd = ShortDate{m, d};
-    auto fr = std::lower_bound(data1.begin(), data1.end(), dd);
-    if(fr==data1.end()) return std::nullopt;
-    if( !(*fr==dd) ) return std::nullopt;
-    return fr;
+    return std::span(markers_pool).subspan(markers_offs[k], markers_offs[k+1]-markers_offs[k]);
   }
 
 public:
 
-  OrthYear(const std::string& year, std::span<const uint8_t> il, bool osen_otstupka_apostol);
+  OrthYear(const big_int& year, std::span<const uint8_t> il, bool osen_otstupka_apostol,
+        std::shared_ptr<CacheMetrics> metrics = {});
+  OrthYear(const std::string& year, std::span<const uint8_t> il, bool osen_otstupka_apostol)
+    : OrthYear(string_to_year(year), il, osen_otstupka_apostol) {}
   OrthYear(const std::string& year, bool o)
     : OrthYear(year, std::array<uint8_t,17>{33,32,33,31,32,33,30,31,32,33,30,31,17,32,33,10,11}, o) {}
   OrthYear(const std::string& year): OrthYear(year, false) {}
   OrthYear(const std::string& year, std::span<const uint8_t> il): OrthYear(year, il, false) {}
+  OrthYear(const OrthYear&) = delete;
+  OrthYear& operator=(const OrthYear&) = delete;
 
-  int8_t get_winter_indent() const { return winter_indent; }
-  int8_t get_spring_indent() const { return spring_indent; }
+  std::size_t memory_usage() const
+  { //приблизительный объем занимаемой памяти в байтах
+    return sizeof(OrthYear) + (markers_pool.capacity() + dates_pool.capacity()) * sizeof(uint16_t);
+  }
+  void build_all() const { require_glas_(); require_readings_(); }//вычислить все ленивые фазы
+  void build_glas() const { require_glas_(); }//вычислить только гласы
+  void build_n50() const { require_n50_(); }//вычислить только номера седмиц по пятидесятнице
+  int8_t get_winter_indent() const { require_n50_(); return winter_indent; }
+  int8_t get_spring_indent() const { require_n50_(); return spring_indent; }
   int8_t get_date_glas(int8_t month, int8_t day) const;
   int8_t get_date_n50(int8_t month, int8_t day) const;
   int8_t get_date_dn(int8_t month, int8_t day) const;
@@ -1281,1035 +2395,209 @@ public:
   ApEvReads get_date_evangelie(int8_t month, int8_t day) const;
   ApEvReads get_resurrect_evangelie(int8_t month, int8_t day) const;
   std::optional<std::vector<uint16_t>> get_date_properties(int8_t month, int8_t day) const;
-  std::optional<ShortDate> get_date_with(oxc_const m) const;
+  DayInfo get_day_info(int8_t month, int8_t day) const;
+  template<typename F>
+    void for_each_day(ShortDate from, ShortDate to, F f) const;
+  //доступ к дню по порядковому номеру k (0 ... get_days_count()-1) без проверки k.
+  //get_day_glas требует build_glas(), get_day_n50 - build_n50(), чтения - build_all()
+  int get_days_count() const { return visokos ? 366 : 365; }
+  int get_day_of_year(int8_t month, int8_t day) const { return day_of_year_({month, day}, visokos); }
+  ShortDate get_date_of_year(int k) const { return date_of_year_(k, visokos); }
+  int8_t get_day_dn(int k) const { return days_hot[k].dn; }
+  int8_t get_day_glas(int k) const { return days_hot[k].glas; }
+  int8_t get_day_n50(int k) const { return days_hot[k].n50; }
+  std::span<const uint16_t> get_day_markers(int k) const { return day_markers_(k); }
+  ApEvReads get_day_apostol(int k) const { return reading_by_id(days_cold[k].apostol); }
+  ApEvReads get_day_evangelie(int k) const { return reading_by_id(days_cold[k].evangelie); }
+  ApEvReads get_day_resurrect(int k) const { return reading_by_id(days_cold[k].resurrect); }
+  bool get_day_has_marker(int k, oxc_const m) const
+  {
+    const auto x = day_markers_(k);
+    return std::binary_search(x.begin(), x.end(), m);
+  }
+  bool get_date_has_property(int8_t month, int8_t day, oxc_const m) const
+  {
+    const int k = day_of_year_({month, day}, visokos);
+    return k>=0 && get_day_has_marker(k, m);
+  }
+  std::span<const uint16_t> get_days_with(oxc_const m) const;
+  //методы get_date_* ищут первую дату в интервале [from; to]
+  std::optional<ShortDate> get_date_with(oxc_const m, ShortDate from = {1,1}, ShortDate to = {12,31}) const;
   std::optional<std::vector<ShortDate>> get_alldates_with(oxc_const m) const;
-  std::optional<ShortDate> get_date_withanyof(std::span<oxc_const> m) const;
-  std::optional<ShortDate> get_date_withallof(std::span<oxc_const> m) const;
+  std::optional<ShortDate> get_date_withanyof(std::span<oxc_const> m, ShortDate from = {1,1},
+        ShortDate to = {12,31}) const;
+  std::optional<ShortDate> get_date_withallof(std::span<oxc_const> m, ShortDate from = {1,1},
+        ShortDate to = {12,31}) const;
   std::optional<std::vector<ShortDate>> get_alldates_withanyof(std::span<oxc_const> m) const;
+  std::optional<ShortDate> get_date_matching(const PropertyQuery& q, ShortDate from = {1,1},
+        ShortDate to = {12,31}) const;
+  std::optional<std::vector<ShortDate>> get_alldates_matching(const PropertyQuery& q) const;
+  std::size_t count_matching(const PropertyQuery& q, ShortDate from = {1,1}, ShortDate to = {12,31}) const;
+  std::optional<ShortDate> get_next_matching(const PropertyQuery& q, std::optional<ShortDate> after) const;
+  std::optional<ShortDate> get_prev_matching(const PropertyQuery& q, std::optional<ShortDate> before) const;
 };
 
-OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool osen_otstupka_apostol)
+int8_t OrthYear::get_days_inmonth_(int8_t month, bool leap)
+{ //функц.возвращает кол-во дней в месяце или -1
+  int8_t k{-1};
+  switch(month) {
+    case 1: { k = 31; }
+        break;
+    case 2: { k = (leap ? 29 : 28); }
+        break;
+    case 3: { k = 31; }
+        break;
+    case 4: { k = 30; }
+        break;
+    case 5: { k = 31; }
+        break;
+    case 6: { k = 30; }
+        break;
+    case 7: { k = 31; }
+        break;
+    case 8: { k = 31; }
+        break;
+    case 9: { k = 30; }
+        break;
+    case 10:{ k = 31; }
+        break;
+    case 11:{ k = 30; }
+        break;
+    case 12:{ k = 31; }
+  };
+  return k;
+}
+
+ShortDate OrthYear::increment_date_(ShortDate date, int days, bool visokos)
+{ //функц.возвращает дату увеличенную на кол-во дней доконца года
+  //если инкремент переходит через конец года, возвращает исходную дату
+  //date.first - месяц; date.second - день
+  ShortDate r {date};
+  ShortDate l {date};
+  if(days<1) { return l; }
+  if(date.first<1 || date.first>12)  { return l; }
+  int u = get_days_inmonth_(date.first, visokos);
+  if(date.second<1 || date.second>u) { return l; }
+  r.second += days;
+  while (r.second>u) {
+    r.second = r.second - u;
+    r.first++;
+    if(r.first>12) return l;
+    u = get_days_inmonth_(r.first, visokos);
+  }
+  return r;
+}
+
+ShortDate OrthYear::decrement_date_(ShortDate date, int days, bool visokos)
+{ //функц.возвращает дату уменьшенную на кол-во дней до начала года
+  //если декремент переходит через начало года, возвращает исходную дату
+  //date.first - месяц; date.second - день
+  ShortDate r {date};
+  ShortDate l {date};
+  if(days<1) { return l; }
+  if(date.first<1 || date.first>12)  { return l; }
+  int u = get_days_inmonth_(date.first, visokos);
+  if(date.second<1 || date.second>u) { return l; }
+  r.second = r.second - days;
+  while (r.second < 1) {
+    r.first--;
+    if(r.first<1) return l;
+    u = get_days_inmonth_(r.first, visokos);
+    r.second = u + r.second;
+  }
+  return r;
+}
+
+std::optional<std::map<ShortDate, int8_t>> OrthYear::create_days_map_(const big_int& y)
+{ //функц.создание карты дней недели указанного года в формате:
+  //key - дата; key.first - месяц; key.second - день
+  //value - деньнедели; 0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб.
+  if(y<1) return std::nullopt;
+  const bool b = is_visokos(y);
+  const auto pasha_date = pasha_calc(y) ;
+  ShortDate data1, data2;
+  std::map<ShortDate, int8_t> result;
+  int i = 0;
+  while (i<7) {
+    data1 = increment_date_(pasha_date, i, b);
+    data2 = increment_date_(data1, 7, b);
+    result.insert({data1, i});
+    while (data1 != data2) {
+      result.insert({data2, i});
+      data1 = data2;
+      data2 = increment_date_(data1, 7, b);
+    }
+    data1 = decrement_date_(pasha_date, 7-i, b);
+    if(data1 != pasha_date) result.insert({data1, i});
+    data2 = decrement_date_(data1, 7, b);
+    while (data2 != data1) {
+      result.insert({data2, i});
+      data1 = data2;
+      data2 = decrement_date_(data1, 7, b);
+    }
+    i++;
+  }
+  return result;
+}
+
+int OrthYear::day_of_year_(const ShortDate& d, bool leap)
+{ //функц.возвращает порядковый номер дня в году (0-365) или -1
+  const int u = get_days_inmonth_(d.first, leap);
+  if(u<0 || d.second<1 || d.second>u) return -1;
+  int k = d.second - 1;
+  for(int8_t m=1; m<d.first; m++) k += get_days_inmonth_(m, leap);
+  return k;
+}
+
+ShortDate OrthYear::date_of_year_(int k, bool leap)
+{ //функц.возвращает дату по порядковому номеру дня в году (0-365)
+  int8_t m = 1;
+  for(int u = get_days_inmonth_(m, leap); k>=u && m<12; u = get_days_inmonth_(m, leap)) {
+    k -= u;
+    m++;
+  }
+  return ShortDate(m, k+1);
+}
+
+int8_t OrthYear::get_dn_prev_year_(const ShortDate& d) const
+{ //функц.поиск дня недели для даты пред. года
+  //отсчитывается от пасхи пред. года (воскресенье)
+  const bool b1 = is_visokos(y-1);
+  const int k = day_of_year_(d, b1);
+  if(k<0) return -1;
+  const int p = day_of_year_(pasha_calc(y-1), b1);
+  return static_cast<int8_t>(((k - p) % 7 + 7) % 7);
+}
+
+OrthYear::OrthYear(const big_int& year, std::span<const uint8_t> il, bool osen_otstupka_apostol,
+      std::shared_ptr<CacheMetrics> metrics) : metrics(std::move(metrics))
 { //main constructor
-  y = string_to_year(year) ;
+  const auto build_start = std::chrono::steady_clock::now();
+  if( year < oxc::MIN_YEAR_VALUE )
+    throw std::out_of_range("выход числа года '"+year.str()+"' за границу диапазона");
+  y = year ;
   bool bad_il{};
   for(auto j: il) if(j<1 || j>33) bad_il = true;
   if(il.size()!=17 || bad_il)
     throw std::runtime_error("установлены некорректные параметры отступки/преступки апостольских/евангельских чтений");
-  //таблица - непереходящие даты года
-  static const std::array stable_dates  = {
-    (int)m1d1, 1, 1,
-    (int)m1d2, 1, 2,
-    (int)m1d3, 1, 3,
-    (int)m1d4, 1, 4,
-    (int)m1d5, 1, 5,
-    (int)m1d6, 1, 6,
-    (int)m1d7, 1, 7,
-    (int)m1d8, 1, 8,
-    (int)m1d9, 1, 9,
-    (int)m1d10, 1, 10,
-    (int)m1d11, 1, 11,
-    (int)m1d12, 1, 12,
-    (int)m1d13, 1, 13,
-    (int)m1d14, 1, 14,
-    (int)m3d25, 3, 25,
-    (int)m6d24, 6, 24,
-    (int)m6d25, 6, 25,
-    (int)m6d29, 6, 29,
-    (int)m8d5, 8, 5,
-    (int)m8d6, 8, 6,
-    (int)m8d7, 8, 7,
-    (int)m8d8, 8, 8,
-    (int)m8d9, 8, 9,
-    (int)m8d10, 8, 10,
-    (int)m8d11, 8, 11,
-    (int)m8d12, 8, 12,
-    (int)m8d13, 8, 13,
-    (int)m8d14, 8, 14,
-    (int)m8d15, 8, 15,
-    (int)m8d16, 8, 16,
-    (int)m8d17, 8, 17,
-    (int)m8d18, 8, 18,
-    (int)m8d19, 8, 19,
-    (int)m8d20, 8, 20,
-    (int)m8d21, 8, 21,
-    (int)m8d22, 8, 22,
-    (int)m8d23, 8, 23,
-    (int)m9d7, 9, 7,
-    (int)m9d8, 9, 8,
-    (int)m9d9, 9, 9,
-    (int)m9d10, 9, 10,
-    (int)m9d11, 9, 11,
-    (int)m9d12, 9, 12,
-    (int)m9d13, 9, 13,
-    (int)m9d14, 9, 14,
-    (int)m9d15, 9, 15,
-    (int)m9d16, 9, 16,
-    (int)m9d17, 9, 17,
-    (int)m9d18, 9, 18,
-    (int)m9d19, 9, 19,
-    (int)m9d20, 9, 20,
-    (int)m9d21, 9, 21,
-    (int)m8d29, 8, 29,
-    (int)m10d1, 10, 1,
-    (int)m11d20, 11, 20,
-    (int)m11d21, 11, 21,
-    (int)m11d22, 11, 22,
-    (int)m11d23, 11, 23,
-    (int)m11d24, 11, 24,
-    (int)m11d25, 11, 25,
-    (int)m12d20, 12, 20,
-    (int)m12d21, 12, 21,
-    (int)m12d22, 12, 22,
-    (int)m12d23, 12, 23,
-    (int)m12d24, 12, 24,
-    (int)m12d25, 12, 25,
-    (int)m12d26, 12, 26,
-    (int)m12d27, 12, 27,
-    (int)m12d28, 12, 28,
-    (int)m12d29, 12, 29,
-    (int)m12d30, 12, 30,
-    (int)m12d31, 12, 31
-  };
+  visokos = is_visokos(y);
+  std::copy(il.begin(), il.end(), indent_opts.begin());
+  this->osen_otstupka_apostol = osen_otstupka_apostol;
   auto make_pair = [](int m, int d){ return ShortDate{m,d}; };
-  //таблица - даты сплошных седмиц
-  static const std::array svyatki_dates = {
-    make_pair(1,1),
-    make_pair(1,2),
-    make_pair(1,3),
-    make_pair(1,4),
-    make_pair(12,25),
-    make_pair(12,26),
-    make_pair(12,27),
-    make_pair(12,28),
-    make_pair(12,29),
-    make_pair(12,30),
-    make_pair(12,31)
-  };
-  //type alias for const tables
-  using TT1 = std::array<std::array<ApEvReads, 7>, 37>;
-  using TT2 = std::map<uint16_t, ApEvReads>;
-  //таблица рядовых чтений на литургии из приложения богосл.евангелия. период от св. троицы до нед. сыропустная
-  //двумерный массив [a][b], где а - календарный номер по пятидесятнице. b - деньнедели.
-  static const TT1 evangelie_table_1 {
-    std::array { ApEvReads{ 0X1B5, "Ин., 27 зач., VII, 37–52; VIII, 12."},  //неделя 0. день св. троицы
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{}
-          },
-    std::array { ApEvReads{ 0X262, "Мф., 38 зач., X, 32–33, 37–38; XIX, 27–30."},  //Неделя 1 всех святых
-            ApEvReads{ 0X4B2, "Мф., 75 зач., XVIII, 10–20."},  //пн - Святаго Духа
-            ApEvReads{ 0XA2, "Мф., 10 зач., IV, 25 – V, 12."},  //вт - седмица 1
-            ApEvReads{ 0XC2, "Мф., 12 зач., V, 20–26."},  //ср
-            ApEvReads{ 0XD2, "Мф., 13 зач., V, 27–32."},  //чт
-            ApEvReads{ 0XE2, "Мф., 14 зач., V, 33–41."},  //пт
-            ApEvReads{ 0XF2, "Мф., 15 зач., V, 42–48."}  //сб
-          },
-    std::array { ApEvReads{ 0X92, "Мф., 9 зач., IV, 18–23."},  //Неделя 2
-            ApEvReads{ 0X132, "Мф., 19 зач., VI, 31–34; VII, 9–11."},  //пн - седмица 2
-            ApEvReads{ 0X162, "Мф., 22 зач., VII, 15–21."},  //вт
-            ApEvReads{ 0X172, "Мф., 23 зач., VII, 21–23."},  //ср
-            ApEvReads{ 0X1B2, "Мф., 27 зач., VIII, 23–27."},  //чт
-            ApEvReads{ 0X1F2, "Мф., 31 зач., IX, 14–17."},  //пт
-            ApEvReads{ 0X142, "Мф., 20 зач., VII, 1–8."}  //сб
-          },
-    std::array { ApEvReads{ 0X122, "Мф., 18 зач., VI, 22–33."},  //Неделя 3
-            ApEvReads{ 0X222, "Мф., 34 зач., IX, 36 – X, 8."},  //пн - седмица 3
-            ApEvReads{ 0X232, "Мф., 35 зач., X, 9–15."},  //вт
-            ApEvReads{ 0X242, "Мф., 36 зач., X, 16–22."},  //ср
-            ApEvReads{ 0X252, "Мф., 37 зач., X, 23–31."},  //чт
-            ApEvReads{ 0X262, "Мф., 38 зач., X, 32–36; XI, 1."},  //пт
-            ApEvReads{ 0X182, "Мф., 24 зач., VII, 24 – VIII, 4."}  //сб
-          },
-    std::array { ApEvReads{ 0X192, "Мф., 25 зач., VIII, 5–13."},  //Неделя 4
-            ApEvReads{ 0X282, "Мф., 40 зач., XI, 2–15."},  //пн - седмица 4
-            ApEvReads{ 0X292, "Мф., 41 зач., XI, 16–20."},  //вт
-            ApEvReads{ 0X2A2, "Мф., 42 зач., XI, 20–26."},  //ср
-            ApEvReads{ 0X2B2, "Мф., 43 зач., XI, 27–30."},  //чт
-            ApEvReads{ 0X2C2, "Мф., 44 зач., XII, 1–8."},  //пт
-            ApEvReads{ 0X1A2, "Мф., 26 зач., VIII, 14–23."}  //сб
-          },
-    std::array { ApEvReads{ 0X1C2, "Мф., 28 зач., VIII, 28 - IX, 1."},  //Неделя 5
-            ApEvReads{ 0X2D2, "Мф., 45 зач., XII, 9-13."},  //пн - седмица 5
-            ApEvReads{ 0X2E2, "Мф., 46 зач., XII, 14–16, 22–30."},  //вт
-            ApEvReads{ 0X302, "Мф., 48 зач., XII, 38–45."},  //ср
-            ApEvReads{ 0X312, "Мф., 49 зач., XII, 46 – XIII, 3."},  //чт
-            ApEvReads{ 0X322, "Мф., 50 зач., XIII, 3–9."},  //пт
-            ApEvReads{ 0X1E2, "Мф., 30 зач., IX, 9–13."}  //сб
-          },
-    std::array { ApEvReads{ 0X1D2, "Мф., 29 зач., IX, 1–8."},  //Неделя 6
-            ApEvReads{ 0X332, "Мф., 51 зач., XIII, 10–23."},  //пн - седмица 6
-            ApEvReads{ 0X342, "Мф., 52 зач., XIII, 24–30."},  //вт
-            ApEvReads{ 0X352, "Мф., 53 зач., XIII, 31–36."},  //ср
-            ApEvReads{ 0X362, "Мф., 54 зач., XIII, 36–43."},  //чт
-            ApEvReads{ 0X372, "Мф., 55 зач., XIII, 44–54."},  //пт
-            ApEvReads{ 0X202, "Мф., 32 зач., IX, 18–26."}  //сб
-          },
-    std::array { ApEvReads{ 0X212, "Мф., 33 зач., IX, 27–35."},  //Неделя 7
-            ApEvReads{ 0X382, "Мф., 56 зач., XIII, 54–58."},  //пн - седмица 7
-            ApEvReads{ 0X392, "Мф., 57 зач., XIV, 1–13."},  //вт
-            ApEvReads{ 0X3C2, "Мф., 60 зач., XIV, 35 – XV, 11."},  //ср
-            ApEvReads{ 0X3D2, "Мф., 61 зач., XV, 12–21."},  //чт
-            ApEvReads{ 0X3F2, "Мф., 63 зач., XV, 29–31."},  //пт
-            ApEvReads{ 0X272, "Мф., 39 зач., X, 37 – XI, 1."}  //сб
-          },
-    std::array { ApEvReads{ 0X3A2, "Мф., 58 зач., XIV, 14–22."},  //Неделя 8
-            ApEvReads{ 0X412, "Мф., 65 зач., XVI, 1-6."},  //пн - седмица 8
-            ApEvReads{ 0X422, "Мф., 66 зач., XVI, 6-12."},  //вт
-            ApEvReads{ 0X442, "Мф., 68 зач., XVI, 20–24."},  //ср
-            ApEvReads{ 0X452, "Мф., 69 зач., XVI, 24–28."},  //чт
-            ApEvReads{ 0X472, "Мф., 71 зач., XVII, 10-18."},  //пт
-            ApEvReads{ 0X2F2, "Мф., 47 зач., XII, 30–37."}  //сб
-          },
-    std::array { ApEvReads{ 0X3B2, "Мф., 59 зач., XIV, 22–34."},  //Неделя 9
-            ApEvReads{ 0X4A2, "Мф., 74 зач., XVIII, 1–11."},  //пн - седмица 9
-            ApEvReads{ 0X4C2, "Мф., 76 зач., XVIII, 18–22; XIX, 1–2, 13–15."},  //вт
-            ApEvReads{ 0X502, "Мф., 80 зач., XX, 1–16."},  //ср
-            ApEvReads{ 0X512, "Мф., 81 зач., XX, 17–28."},  //чт
-            ApEvReads{ 0X532, "Мф., 83 зач., XXI, 1–11, 15–17."},  //пт
-            ApEvReads{ 0X402, "Мф., 64 зач., XV, 32–39."}  //сб
-          },
-    std::array { ApEvReads{ 0X482, "Мф., 72 зач., XVII, 14–23."},  //Неделя 10
-            ApEvReads{ 0X542, "Мф., 84 зач., XXI, 18–22."},  //пн - седмица 10
-            ApEvReads{ 0X552, "Мф., 85 зач., XXI, 23–27."},  //вт
-            ApEvReads{ 0X562, "Мф., 86 зач., XXI, 28–32."},  //ср
-            ApEvReads{ 0X582, "Мф., 88 зач., XXI, 43-46."},  //чт
-            ApEvReads{ 0X5B2, "Мф., 91 зач., XXII, 23–33."},  //пт
-            ApEvReads{ 0X492, "Мф., 73 зач., XVII, 24 – XVIII, 4."}  //сб
-          },
-    std::array { ApEvReads{ 0X4D2, "Мф., 77 зач., XVIII, 23–35."},  //Неделя 11
-            ApEvReads{ 0X5E2, "Мф., 94 зач., XXIII, 13–22."},  //пн - седмица 11
-            ApEvReads{ 0X5F2, "Мф., 95 зач., XXIII, 23-28."},  //вт
-            ApEvReads{ 0X602, "Мф., 96 зач., XXIII, 29–39."},  //ср
-            ApEvReads{ 0X632, "Мф., 99 зач., XXIV, 13–28."},  //чт
-            ApEvReads{ 0X642, "Мф., 100 зач., XXIV, 27–33, 42–51."},  //пт
-            ApEvReads{ 0X4E2, "Мф., 78 зач., XIX, 3–12."}  //сб
-          },
-    std::array { ApEvReads{ 0X4F2, "Мф., 79 зач., XIX, 16–26."},  //Неделя 12
-            ApEvReads{ 0X23, "Мк., 2 зач., I, 9–15."},  //пн - седмица 12
-            ApEvReads{ 0X33, "Мк., 3 зач., I, 16–22."},  //вт
-            ApEvReads{ 0X43, "Мк., 4 зач., I, 23–28."},  //ср
-            ApEvReads{ 0X53, "Мк., 5 зач., I, 29-35."},  //чт
-            ApEvReads{ 0X93, "Мк., 9 зач., II, 18–22."},  //пт
-            ApEvReads{ 0X522, "Мф., 82 зач., XX, 29–34."}  //сб
-          },
-    std::array { ApEvReads{ 0X572, "Мф., 87 зач., XXI, 33–42."},  //Неделя 13
-            ApEvReads{ 0XB3, "Мк., 11 зач., III, 6–12."},  //пн - седмица 13
-            ApEvReads{ 0XC3, "Мк., 12 зач., III, 13–19."},  //вт
-            ApEvReads{ 0XD3, "Мк., 13 зач., III, 20–27."},  //ср
-            ApEvReads{ 0XE3, "Мк., 14 зач., III, 28–35."},  //чт
-            ApEvReads{ 0XF3, "Мк., 15 зач., IV, 1–9."},  //пт
-            ApEvReads{ 0X5A2, "Мф., 90 зач., XXII, 15-22."}  //сб
-          },
-    std::array { ApEvReads{ 0X592, "Мф., 89 зач., XXII, 1–14."},  //Неделя 14
-            ApEvReads{ 0X103, "Мк., 16 зач., IV, 10–23."},  //пн - седмица 14
-            ApEvReads{ 0X113, "Мк., 17 зач., IV, 24–34."},  //вт
-            ApEvReads{ 0X123, "Мк., 18 зач., IV, 35–41."},  //ср
-            ApEvReads{ 0X133, "Мк., 19 зач., V, 1-20."},  //чт
-            ApEvReads{ 0X143, "Мк., 20 зач., V, 22–24, 35 – VI, 1."},  //пт
-            ApEvReads{ 0X5D2, "Мф., 93 зач., XXIII, 1–12."}  //сб
-          },
-    std::array { ApEvReads{ 0X5C2, "Мф., 92 зач., XXII, 35–46."},  //Неделя 15
-            ApEvReads{ 0X153, "Мк., 21 зач., V, 24–34."},  //пн - седмица 15
-            ApEvReads{ 0X163, "Мк., 22 зач., VI, 1-7."},  //вт
-            ApEvReads{ 0X173, "Мк., 23 зач., VI, 7–13."},  //ср
-            ApEvReads{ 0X193, "Мк., 25 зач., VI, 30–45."},  //чт
-            ApEvReads{ 0X1A3, "Мк., 26 зач., VI, 45–53."},  //пт
-            ApEvReads{ 0X612, "Мф., 97 зач., XXIV, 1–13."}  //сб
-          },
-    std::array { ApEvReads{ 0X692, "Мф., 105 зач., XXV, 14-30."},  //Неделя 16
-            ApEvReads{ 0X1B3, "Мк., 27 зач., VI, 54 - VII, 8."},  //пн - седмица 16
-            ApEvReads{ 0X1C3, "Мк., 28 зач., VII, 5-16."},  //вт
-            ApEvReads{ 0X1D3, "Мк., 29 зач., VII, 14–24."},  //ср
-            ApEvReads{ 0X1E3, "Мк., 30 зач., VII, 24–30."},  //чт
-            ApEvReads{ 0X203, "Мк., 32 зач., VIII, 1-10."},  //пт
-            ApEvReads{ 0X652, "Мф., 101 зач., XXIV, 34–44."}  //сб
-          },
-    std::array { ApEvReads{ 0X3E2, "Мф., 62 зач., XV, 21–28."},  //Неделя 17
-            ApEvReads{ 0X303, "Мк., 48 зач., X, 46–52."},  //пн - седмица 17
-            ApEvReads{ 0X323, "Мк., 50 зач., XI, 11–23."},  //вт
-            ApEvReads{ 0X333, "Мк., 51 зач., XI, 23–26."},  //ср
-            ApEvReads{ 0X343, "Мк., 52 зач., XI, 27–33."},  //чт
-            ApEvReads{ 0X353, "Мк., 53 зач., XII, 1–12."},  //пт
-            ApEvReads{ 0X682, "Мф., 104 зач., XXV, 1–13."}  //сб
-          },
-    std::array { ApEvReads{ 0X114, "Лк., 17 зач., V, 1–11."},  //Неделя 18
-            ApEvReads{ 0XA4, "Лк., 10 зач., III, 19–22."},  //пн - седмица 18
-            ApEvReads{ 0XB4, "Лк., 11 зач., III, 23 – IV, 1."},  //вт
-            ApEvReads{ 0XC4, "Лк., 12 зач., IV, 1-15."},  //ср
-            ApEvReads{ 0XD4, "Лк., 13 зач., IV, 16–22."},  //чт
-            ApEvReads{ 0XE4, "Лк., 14 зач., IV, 22–30."},  //пт
-            ApEvReads{ 0XF4, "Лк., 15 зач., IV, 31–36."}  //сб
-          },
-    std::array { ApEvReads{ 0X1A4, "Лк., 26 зач., VI, 31–36."},  //Неделя 19
-            ApEvReads{ 0X104, "Лк., 16 зач., IV, 37–44."},  //пн - седмица 19
-            ApEvReads{ 0X124, "Лк., 18 зач., V, 12-16."},  //вт
-            ApEvReads{ 0X154, "Лк., 21 зач., V, 33–39."},  //ср
-            ApEvReads{ 0X174, "Лк., 23 зач., VI, 12–19."},  //чт
-            ApEvReads{ 0X184, "Лк., 24 зач., VI, 17–23."},  //пт
-            ApEvReads{ 0X134, "Лк., 19 зач., V, 17–26."}  //сб
-          },
-    std::array { ApEvReads{ 0X1E4, "Лк., 30 зач., VII, 11–16."},  //Неделя 20
-            ApEvReads{ 0X194, "Лк., 25 зач., VI, 24–30."},  //пн - седмица 20
-            ApEvReads{ 0X1B4, "Лк., 27 зач., VI, 37–45."},  //вт
-            ApEvReads{ 0X1C4, "Лк., 28 зач., VI, 46 – VII, 1."},  //ср
-            ApEvReads{ 0X1F4, "Лк., 31 зач., VII, 17–30."},  //чт
-            ApEvReads{ 0X204, "Лк., 32 зач., VII, 31–35."},  //пт
-            ApEvReads{ 0X144, "Лк., 20 зач., V, 27–32."}  //сб
-          },
-    std::array { ApEvReads{ 0X234, "Лк., 35 зач., VIII, 5–15."},  //Неделя 21
-            ApEvReads{ 0X214, "Лк., 33 зач., VII, 36–50."},  //пн - седмица 21
-            ApEvReads{ 0X224, "Лк., 34 зач., VIII, 1–3."},  //вт
-            ApEvReads{ 0X254, "Лк., 37 зач., VIII, 22–25."},  //ср
-            ApEvReads{ 0X294, "Лк., 41 зач., IX, 7–11."},  //чт
-            ApEvReads{ 0X2A4, "Лк., 42 зач., IX, 12–18."},  //пт
-            ApEvReads{ 0X164, "Лк., 22 зач., VI, 1–10."}  //сб
-          },
-    std::array { ApEvReads{ 0X534, "Лк., 83 зач., XVI, 19–31."},  //Неделя 22
-            ApEvReads{ 0X2B4, "Лк., 43 зач., IX, 18–22."},  //пн - седмица 22
-            ApEvReads{ 0X2C4, "Лк., 44 зач., IX, 23-27."},  //вт
-            ApEvReads{ 0X2F4, "Лк., 47 зач., IX, 44–50."},  //ср
-            ApEvReads{ 0X304, "Лк., 48 зач., IX, 49–56."},  //чт
-            ApEvReads{ 0X324, "Лк., 50 зач., X, 1–15."},  //пт
-            ApEvReads{ 0X1D4, "Лк., 29 зач., VII, 1–10."}  //сб
-          },
-    std::array { ApEvReads{ 0X264, "Лк., 38 зач., VIII, 26–39."},  //Неделя 23
-            ApEvReads{ 0X344, "Лк., 52 зач., X, 22–24."},  //пн - седмица 23
-            ApEvReads{ 0X374, "Лк., 55 зач., XI, 1–10."},  //вт
-            ApEvReads{ 0X384, "Лк., 56 зач., XI, 9–13."},  //ср
-            ApEvReads{ 0X394, "Лк., 57 зач., XI, 14–23."},  //чт
-            ApEvReads{ 0X3A4, "Лк., 58 зач., XI, 23–26."},  //пт
-            ApEvReads{ 0X244, "Лк., 36 зач., VIII, 16–21."}  //сб
-          },
-    std::array { ApEvReads{ 0X274, "Лк., 39 зач., VIII, 41–56."},  //Неделя 24
-            ApEvReads{ 0X3B4, "Лк., 59 зач., XI, 29–33."},  //пн - седмица 24
-            ApEvReads{ 0X3C4, "Лк., 60 зач., XI, 34–41."},  //вт
-            ApEvReads{ 0X3D4, "Лк., 61 зач., XI, 42–46."},  //ср
-            ApEvReads{ 0X3E4, "Лк., 62 зач., XI, 47 – XII, 1."},  //чт
-            ApEvReads{ 0X3F4, "Лк., 63 зач., XII, 2–12."},  //пт
-            ApEvReads{ 0X284, "Лк., 40 зач., IX, 1–6."}  //сб
-          },
-    std::array { ApEvReads{ 0X354, "Лк., 53 зач., X, 25–37."},  //Неделя 25
-            ApEvReads{ 0X414, "Лк., 65 зач., XII, 13–15, 22–31."},  //пн - седмица 25
-            ApEvReads{ 0X444, "Лк., 68 зач., XII, 42–48."},  //вт
-            ApEvReads{ 0X454, "Лк., 69 зач., XII, 48-59."},  //ср
-            ApEvReads{ 0X464, "Лк., 70 зач., XIII, 1–9."},  //чт
-            ApEvReads{ 0X494, "Лк., 73 зач., XIII, 31–35."},  //пт
-            ApEvReads{ 0X2E4, "Лк., 46 зач., IX, 37–43."}  //сб
-          },
-    std::array { ApEvReads{ 0X424, "Лк., 66 зач., XII, 16–21."},  //Неделя 26
-            ApEvReads{ 0X4B4, "Лк., 75 зач., XIV, 12–15."},  //пн - седмица 26
-            ApEvReads{ 0X4D4, "Лк., 77 зач., XIV, 25–35."},  //вт
-            ApEvReads{ 0X4E4, "Лк., 78 зач., XV, 1–10."},  //ср
-            ApEvReads{ 0X504, "Лк., 80 зач., XVI, 1-9."},  //чт
-            ApEvReads{ 0X524, "Лк., 82 зач., XVI, 15–18; XVII, 1–4."},  //пт
-            ApEvReads{ 0X314, "Лк., 49 зач., IX, 57–62."}  //сб
-          },
-    std::array { ApEvReads{ 0X474, "Лк., 71 зач., XIII, 10–17."},  //Неделя 27
-            ApEvReads{ 0X564, "Лк., 86 зач., XVII, 20–25."},  //пн - седмица 27
-            ApEvReads{ 0X574, "Лк., 87 зач., XVII, 26–37."},  //вт
-            ApEvReads{ 0X5A4, "Лк., 90 зач., XVIII, 15–17, 26–30."},  //ср
-            ApEvReads{ 0X5C4, "Лк., 92 зач., XVIII, 31–34."},  //чт
-            ApEvReads{ 0X5F4, "Лк., 95 зач., XIX, 12–28."},  //пт
-            ApEvReads{ 0X334, "Лк., 51 зач., X, 16–21."}  //сб
-          },
-    std::array { ApEvReads{ 0X4C4, "Лк., 76 зач., XIV, 16–24."},  //Неделя 28
-            ApEvReads{ 0X614, "Лк., 97 зач., XIX, 37–44."},  //пн - седмица 28
-            ApEvReads{ 0X624, "Лк., 98 зач., XIX, 45–48."},  //вт
-            ApEvReads{ 0X634, "Лк., 99 зач., XX, 1–8."},  //ср
-            ApEvReads{ 0X644, "Лк., 100 зач., XX, 9–18."},  //чт
-            ApEvReads{ 0X654, "Лк., 101 зач., XX, 19-26."},  //пт
-            ApEvReads{ 0X434, "Лк., 67 зач., XII, 32–40."}  //сб
-          },
-    std::array { ApEvReads{ 0X554, "Лк., 85 зач., XVII, 12–19."},  //Неделя 29
-            ApEvReads{ 0X664, "Лк., 102 зач., XX, 27–44."},  //пн - седмица 29
-            ApEvReads{ 0X6A4, "Лк., 106 зач., XXI, 12–19."},  //вт
-            ApEvReads{ 0X684, "Лк., 104 зач., XXI, 5–7, 10–11, 20–24."},  //ср
-            ApEvReads{ 0X6B4, "Лк., 107 зач., XXI, 28–33."},  //чт
-            ApEvReads{ 0X6C4, "Лк., 108 зач., XXI, 37 – XXII, 8."},  //пт
-            ApEvReads{ 0X484, "Лк., 72 зач., XIII, 18–29."}  //сб
-          },
-    std::array { ApEvReads{ 0X5B4, "Лк., 91 зач., XVIII, 18-27."},  //Неделя 30
-            ApEvReads{ 0X213, "Мк., 33 зач., VIII, 11–21."},  //пн - седмица 30
-            ApEvReads{ 0X223, "Мк., 34 зач., VIII, 22–26."},  //вт
-            ApEvReads{ 0X243, "Мк., 36 зач., VIII, 30–34."},  //ср
-            ApEvReads{ 0X273, "Мк., 39 зач., IX, 10–16."},  //чт
-            ApEvReads{ 0X293, "Мк., 41 зач., IX, 33–41."},  //пт
-            ApEvReads{ 0X4A4, "Лк., 74 зач., XIV, 1–11."}  //сб
-          },
-    std::array { ApEvReads{ 0X5D4, "Лк., 93 зач., XVIII, 35-43."},  //Неделя 31
-            ApEvReads{ 0X2A3, "Мк., 42 зач., IX, 42 – X, 1."},  //пн - седмица 31
-            ApEvReads{ 0X2B3, "Мк., 43 зач., X, 2–12."},  //вт
-            ApEvReads{ 0X2C3, "Мк., 44 зач., X, 11–16."},  //ср
-            ApEvReads{ 0X2D3, "Мк., 45 зач., X, 17–27."},  //чт
-            ApEvReads{ 0X2E3, "Мк., 46 зач., X, 23–32."},  //пт
-            ApEvReads{ 0X514, "Лк., 81 зач., XVI, 10–15."}  //сб
-          },
-    std::array { ApEvReads{ 0X5E4, "Лк., 94 зач., XIX, 1-10."},  //Неделя 32
-            ApEvReads{ 0X303, "Мк., 48 зач., X, 46–52."},  //пн - седмица 32
-            ApEvReads{ 0X323, "Мк., 50 зач., XI, 11–23."},  //вт
-            ApEvReads{ 0X333, "Мк., 51 зач., XI, 23–26."},  //ср
-            ApEvReads{ 0X343, "Мк., 52 зач., XI, 27–33."},  //чт
-            ApEvReads{ 0X353, "Мк., 53 зач., XII, 1–12."},  //пт
-            ApEvReads{ 0X544, "Лк., 84 зач., XVII, 3–10."}  //сб
-          },
-    std::array { ApEvReads{ 0X594, "Лк., 89 зач., XVIII, 10–14."},  //Неделя 33 о мытари и фарисеи
-            ApEvReads{ 0X363, "Мк., 54 зач., XII, 13–17."},  //пн - седмица 33
-            ApEvReads{ 0X373, "Мк., 55 зач., XII, 18–27."},  //вт
-            ApEvReads{ 0X383, "Мк., 56 зач., XII, 28–37."},  //ср
-            ApEvReads{ 0X393, "Мк., 57 зач., XII, 38–44."},  //чт
-            ApEvReads{ 0X3A3, "Мк., 58 зач., XIII, 1–8."},  //пт
-            ApEvReads{ 0X584, "Лк., 88 зач., XVIII, 2–8."}  //сб
-          },
-    std::array { ApEvReads{ 0X4F4, "Лк., 79 зач., XV, 11–32."},  //Неделя 34 о блуднем сыне
-            ApEvReads{ 0X3B3, "Мк., 59 зач., XIII, 9–13."},  //пн - седмица 34
-            ApEvReads{ 0X3C3, "Мк., 60 зач., XIII, 14-23."},  //вт
-            ApEvReads{ 0X3D3, "Мк., 61 зач., XIII, 24–31."},  //ср
-            ApEvReads{ 0X3E3, "Мк., 62 зач., XIII, 31 – XIV, 2."},  //чт
-            ApEvReads{ 0X3F3, "Мк., 63 зач., XIV, 3-9."},  //пт
-            ApEvReads{ 0X674, "Лк., 103 зач., XX, 45 – XXI, 4."}  //сб
-          },
-    std::array { ApEvReads{ 0X6A2, "Мф., 106 зач., XXV, 31–46."},  //Неделя 35 мясопустная
-            ApEvReads{ 0X313, "Мк., 49 зач., XI, 1–11."},  //пн - седмица 35
-            ApEvReads{ 0X403, "Мк., 64 зач., XIV, 10–42."},  //вт
-            ApEvReads{ 0X413, "Мк., 65 зач., XIV, 43 – XV, 1."},  //ср
-            ApEvReads{ 0X423, "Мк., 66 зач., XV, 1–15."},  //чт
-            ApEvReads{ 0X443, "Мк., 68 зач., XV, 22, 25, 33–41."},  //пт
-            ApEvReads{ 0X694, "Лк., 105 зач., XXI, 8–9, 25–27, 33–36."}  //сб
-          },
-    std::array { ApEvReads{ 0X112, "Мф., 17 зач., VI, 14–21."},  //Неделя 36 сыропустная
-            ApEvReads{ 0X604, "Лк., 96 зач., XIX, 29–40; XXII, 7–39."},  //пн - седмица 36
-            ApEvReads{ 0X6D4, "Лк., 109 зач., XXII, 39–42, 45 – XXIII, 1."},  //вт
-            ApEvReads{},  //ср
-            ApEvReads{ 0X6E4, "Лк., 110 зач., XXIII, 1–34, 44–56."},  //чт
-            ApEvReads{},  //пт
-            ApEvReads{ 0X102, "Мф., 16 зач., VI, 1–13."}  //сб
-          }
-  };
-  auto evangelie_table1_get_chteniya = [](int8_t n50, int8_t dn) {
-    return ApEvReads(evangelie_table_1.at(n50).at(dn));
-  };
-  //таблица рядовых чтений на литургии из приложения богосл.апостола. период от св. троицы до нед. сыропустная
-  //двумерный массив [a][b], где а - календарный номер по пятидесятнице. b - деньнедели.
-  static const TT1 apostol_table_1 {
-    std::array { ApEvReads{ 0X31, "Деян., 3 зач., II, 1–11."},  //неделя 0. день св. троицы
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{},
-            ApEvReads{}
-          },
-    std::array { ApEvReads{ 0X14A1, "Евр., 330 зач., XI, 33 – XII, 2."},  //Неделя 1 всех святых
-            ApEvReads{ 0XE51, "Еф., 229 зач., V, 8–19."},  //пн - Святаго Духа
-            ApEvReads{ 0X4F1, "Рим., 79 зач., I, 1–7, 13–17."},  //вт - седмица 1
-            ApEvReads{ 0X501, "Рим., 80 зач., I, 18–27."},  //ср
-            ApEvReads{ 0X511, "Рим., 81 зач., I, 28 – II, 9."},  //чт
-            ApEvReads{ 0X521, "Рим., 82 зач., II, 14–29."},  //пт
-            ApEvReads{ 0X4F1, "Рим., 79 зач., I, 7-12."}  //сб
-          },
-    std::array { ApEvReads{ 0X511, "Рим., 81 зач., II, 10-16."},  //Неделя 2
-            ApEvReads{ 0X531, "Рим., 83 зач., II, 28 – III, 18."},  //пн - седмица 2
-            ApEvReads{ 0X561, "Рим., 86 зач., IV, 4–12."},  //вт
-            ApEvReads{ 0X571, "Рим., 87 зач., IV, 13–25."},  //ср
-            ApEvReads{ 0X591, "Рим., 89 зач., V, 10–16."},  //чт
-            ApEvReads{ 0X5A1, "Рим., 90 зач., V, 17 – VI, 2."},  //пт
-            ApEvReads{ 0X541, "Рим., 84 зач., III, 19–26."}  //сб
-          },
-    std::array { ApEvReads{ 0X581, "Рим., 88 зач., V, 1–10."},  //Неделя 3
-            ApEvReads{ 0X5E1, "Рим., 94 зач., VII, 1–13."},  //пн - седмица 3
-            ApEvReads{ 0X5F1, "Рим., 95 зач., VII, 14 – VIII, 2."},  //вт
-            ApEvReads{ 0X601, "Рим., 96 зач., VIII, 2–13."},//ср
-            ApEvReads{ 0X621, "Рим., 98 зач., VIII, 22–27."},  //чт
-            ApEvReads{ 0X651, "Рим., 101 зач., IX, 6–19."},  //пт
-            ApEvReads{ 0X551, "Рим., 85 зач., III, 28 – IV, 3."}  //сб
-          },
-    std::array { ApEvReads{ 0X5D1, "Рим., 93 зач., VI, 18-23."},  //Неделя 4
-            ApEvReads{ 0X661, "Рим., 102 зач., IX, 18–33."},  //пн - седмица 4
-            ApEvReads{ 0X681, "Рим., 104 зач., X, 11 – XI, 2."},  //вт
-            ApEvReads{ 0X691, "Рим., 105 зач., XI, 2–12."},  //ср
-            ApEvReads{ 0X6A1, "Рим., 106 зач., XI, 13–24."},  //чт
-            ApEvReads{ 0X6B1, "Рим., 107 зач., XI, 25–36."},  //пт
-            ApEvReads{ 0X5C1, "Рим., 92 зач., VI, 11–17."}  //сб
-          },
-    std::array { ApEvReads{ 0X671, "Рим., 103 зач., X, 1–10."},  //Неделя 5
-            ApEvReads{ 0X6D1, "Рим., 109 зач., XII, 4–5, 15–21."},  //пн - седмица 5
-            ApEvReads{ 0X721, "Рим., 114 зач., XIV, 9–18."},  //вт
-            ApEvReads{ 0X751, "Рим., 117 зач., XV, 7–16."},  //ср
-            ApEvReads{ 0X761, "Рим., 118 зач., XV, 17–29."},  //чт
-            ApEvReads{ 0X781, "Рим., 120 зач., XVI, 1–16."},  //пт
-            ApEvReads{ 0X611, "Рим., 97 зач., VIII, 14–21."}  //сб
-          },
-    std::array { ApEvReads{ 0X6E1, "Рим., 110 зач., XII, 6–14."},  //Неделя 6
-            ApEvReads{ 0X791, "Рим., 121 зач., XVI, 17–24."},  //пн - седмица 6
-            ApEvReads{ 0X7A1, "1 Кор., 122 зач., I, 1–9."},  //вт
-            ApEvReads{ 0X7F1, "1 Кор., 127 зач., II, 9 – III, 8."},  //ср
-            ApEvReads{ 0X811, "1 Кор., 129 зач., III, 18–23."},  //чт
-            ApEvReads{ 0X821, "1 Кор., 130 зач., IV, 5-8."},  //пт
-            ApEvReads{ 0X641, "Рим., 100 зач., IX, 1–5."}  //сб
-          },
-    std::array { ApEvReads{ 0X741, "Рим., 116 зач., XV, 1–7."},  //Неделя 7
-            ApEvReads{ 0X861, "1 Кор., 134 зач., V, 9 – VI, 11."},  //пн - седмица 7
-            ApEvReads{ 0X881, "1 Кор., 136 зач., VI, 20 – VII, 12."},  //вт
-            ApEvReads{ 0X891, "1 Кор., 137 зач., VII, 12–24."},  //ср
-            ApEvReads{ 0X8A1, "1 Кор., 138 зач., VII, 24–35."},  //чт
-            ApEvReads{ 0X8B1, "1 Кор., 139 зач., VII, 35 – VIII, 7."},  //пт
-            ApEvReads{ 0X6C1, "Рим., 108 зач., XII, 1–3."}  //сб
-          },
-    std::array { ApEvReads{ 0X7C1, "1 Кор., 124 зач., I, 10–18."},  //Неделя 8
-            ApEvReads{ 0X8E1, "1 Кор., 142 зач., IX, 13–18."},  //пн - седмица 8
-            ApEvReads{ 0X901, "1 Кор., 144 зач., X, 5–12."},  //вт
-            ApEvReads{ 0X911, "1 Кор., 145 зач., X, 12–22."},  //ср
-            ApEvReads{ 0X931, "1 Кор., 147 зач., X, 28 – XI, 7."},  //чт
-            ApEvReads{ 0X941, "1 Кор., 148 зач., XI, 8–22."},  //пт
-            ApEvReads{ 0X6F1, "Рим., 111 зач., XIII, 1–10."}  //сб
-          },
-    std::array { ApEvReads{ 0X801, "1 Кор., 128 зач., III, 9–17."},  //Неделя 9
-            ApEvReads{ 0X961, "1 Кор., 150 зач., XI, 31 – XII, 6."},  //пн - седмица 9
-            ApEvReads{ 0X981, "1 Кор., 152 зач., XII, 12–26."},  //вт
-            ApEvReads{ 0X9A1, "1 Кор., 154 зач., XIII, 4 – XIV, 5."},//ср
-            ApEvReads{ 0X9B1, "1 Кор., 155 зач., XIV, 6–19."},  //чт
-            ApEvReads{ 0X9D1, "1 Кор., 157 зач., XIV, 26–40."},  //пт
-            ApEvReads{ 0X711, "Рим., 113 зач., XIV, 6–9."}  //сб
-          },
-    std::array { ApEvReads{ 0X831, "1 Кор., 131 зач., IV, 9–16."},  //Неделя 10
-            ApEvReads{ 0X9F1, "1 Кор., 159 зач., XV, 12–19."},  //пн - седмица 10
-            ApEvReads{ 0XA11, "1 Кор., 161 зач., XV, 29–38."},  //вт
-            ApEvReads{ 0XA51, "1 Кор., 165 зач., XVI, 4–12."},  //ср
-            ApEvReads{ 0XA71, "2 Кор., 167 зач., I, 1–7."},//чт
-            ApEvReads{ 0XA91, "2 Кор., 169 зач., I, 12–20."},  //пт
-            ApEvReads{ 0X771, "Рим., 119 зач., XV, 30–33."}  //сб
-          },
-    std::array { ApEvReads{ 0X8D1, "1 Кор., 141 зач., IX, 2–12."},  //Неделя 11
-            ApEvReads{ 0XAB1, "2 Кор., 171 зач., II, 3–15."},  //пн - седмица 11
-            ApEvReads{ 0XAC1, "2 Кор., 172 зач., II, 14 – III, 3."},  //вт
-            ApEvReads{ 0XAD1, "2 Кор., 173 зач., III, 4–11."},  //ср
-            ApEvReads{ 0XAF1, "2 Кор., 175 зач., IV, 1–6."},  //чт
-            ApEvReads{ 0XB11, "2 Кор., 177 зач., IV, 13–18."},  //пт
-            ApEvReads{ 0X7B1, "1 Кор., 123 зач., I, 3–9."}  //сб
-          },
-    std::array { ApEvReads{ 0X9E1, "1 Кор., 158 зач., XV, 1-11."},  //Неделя 12
-            ApEvReads{ 0XB31, "2 Кор., 179 зач., V, 10–15."},  //пн - седмица 12
-            ApEvReads{ 0XB41, "2 Кор., 180 зач., V, 15–21."},  //вт
-            ApEvReads{ 0XB61, "2 Кор., 182 зач., VI, 11–16."},  //ср
-            ApEvReads{ 0XB71, "2 Кор., 183 зач., VII, 1–10."},  //чт
-            ApEvReads{ 0XB81, "2 Кор., 184 зач., VII, 10–16."},  //пт
-            ApEvReads{ 0X7D1, "1 Кор., 125 зач., I, 18-24."}  //сб
-          },
-    std::array { ApEvReads{ 0XA61, "1 Кор., 166 зач., XVI, 13–24."},  //Неделя 13
-            ApEvReads{ 0XBA1, "2 Кор., 186 зач., VIII, 7–15."},  //пн - седмица 13
-            ApEvReads{ 0XBB1, "2 Кор., 187 зач., VIII, 16 – IX, 5."},  //вт
-            ApEvReads{ 0XBD1, "2 Кор., 189 зач., IX, 12 – X, 7."},  //ср
-            ApEvReads{ 0XBE1, "2 Кор., 190 зач., X, 7–18."},  //чт
-            ApEvReads{ 0XC01, "2 Кор., 192 зач., XI, 5–21."},  //пт
-            ApEvReads{ 0X7E1, "1 Кор., 126 зач., II, 6–9."}  //сб
-          },
-    std::array { ApEvReads{ 0XAA1, "2 Кор., 170 зач., I, 21 – II, 4."},  //Неделя 14
-            ApEvReads{ 0XC31, "2 Кор., 195 зач., XII, 10–19."},  //пн - седмица 14
-            ApEvReads{ 0XC41, "2 Кор., 196 зач., XII, 20 – XIII, 2."},  //вт
-            ApEvReads{ 0XC51, "2 Кор., 197 зач., XIII, 3–13."},  //ср
-            ApEvReads{ 0XC61, "Гал., 198 зач., I, 1–10, 20 – II, 5."},  //чт
-            ApEvReads{ 0XC91, "Гал., 201 зач., II, 6–10."},  //пт
-            ApEvReads{ 0X821, "1 Кор., 130 зач., IV, 1–5."}  //сб
-          },
-    std::array { ApEvReads{ 0XB01, "2 Кор., 176 зач., IV, 6–15."},  //Неделя 15
-            ApEvReads{ 0XCA1, "Гал., 202 зач., II, 11–16."},  //пн - седмица 15
-            ApEvReads{ 0XCC1, "Гал., 204 зач., II, 21 – III, 7."},  //вт
-            ApEvReads{ 0XCF1, "Гал., 207 зач., III, 15–22."},  //ср
-            ApEvReads{ 0XD01, "Гал., 208 зач., III, 23 - IV, 5."},  //чт
-            ApEvReads{ 0XD21, "Гал., 210 зач., IV, 8–21."},  //пт
-            ApEvReads{ 0X841, "1 Кор., 132 зач., IV, 17 – V, 5."}  //сб
-          },
-    std::array { ApEvReads{ 0XB51, "2 Кор., 181 зач., VI, 1–10."},  //Неделя 16
-            ApEvReads{ 0XD31, "Гал., 211 зач., IV, 28 – V, 10."},  //пн - седмица 16
-            ApEvReads{ 0XD41, "Гал., 212 зач., V, 11–21."},  //вт
-            ApEvReads{ 0XD61, "Гал., 214 зач., VI, 2–10."},  //ср
-            ApEvReads{ 0XD81, "Еф., 216 зач., I, 1–9."},  //чт
-            ApEvReads{ 0XD91, "Еф., 217 зач., I, 7–17."},  //пт
-            ApEvReads{ 0X921, "1 Кор., 146 зач., X, 23–28."}  //сб
-          },
-    std::array { ApEvReads{ 0XB61, "2 Кор., 182 зач., VI, 16 - VII, 1."},//Неделя 17
-            ApEvReads{ 0XDB1, "Еф., 219 зач., I, 22 – II, 3."},  //пн - седмица 17
-            ApEvReads{ 0XDE1, "Еф., 222 зач., II, 19 – III, 7."},  //вт
-            ApEvReads{ 0XDF1, "Еф., 223 зач., III, 8–21."},  //ср
-            ApEvReads{ 0XE11, "Еф., 225 зач., IV, 14–19."},  //чт
-            ApEvReads{ 0XE21, "Еф., 226 зач., IV, 17–25."},  //пт
-            ApEvReads{ 0X9C1, "1 Кор., 156 зач., XIV, 20–25."}  //сб
-          },
-    std::array { ApEvReads{ 0XBC1, "2 Кор., 188 зач., IX, 6–11."},  //Неделя 18
-            ApEvReads{ 0XE31, "Еф., 227 зач., IV, 25–32."},  //пн - седмица 18
-            ApEvReads{ 0XE61, "Еф., 230 зач., V, 20–26."},  //вт
-            ApEvReads{ 0XE71, "Еф., 231 зач., V, 25–33."},  //ср
-            ApEvReads{ 0XE81, "Еф., 232 зач., V, 33 – VI, 9."},  //чт
-            ApEvReads{ 0XEA1, "Еф., 234 зач., VI, 18–24."},  //пт
-            ApEvReads{ 0XA21, "1 Кор., 162 зач., XV, 39–45."}  //сб
-          },
-    std::array { ApEvReads{ 0XC21, "2 Кор., 194 зач., XI, 31 – XII, 9."},  //Неделя 19
-            ApEvReads{ 0XEB1, "Флп., 235 зач., I, 1–7."},  //пн - седмица 19
-            ApEvReads{ 0XEC1, "Флп., 236 зач., I, 8–14."},  //вт
-            ApEvReads{ 0XED1, "Флп., 237 зач., I, 12–20."},  //ср
-            ApEvReads{ 0XEE1, "Флп., 238 зач., I, 20–27."},  //чт
-            ApEvReads{ 0XEF1, "Флп., 239 зач., I, 27 – II, 4."},  //пт
-            ApEvReads{ 0XA41, "1 Кор., 164 зач., XV, 58 – XVI, 3."}  //сб
-          },
-    std::array { ApEvReads{ 0XC81, "Гал., 200 зач., I, 11–19."},  //Неделя 20
-            ApEvReads{ 0XF11, "Флп., 241 зач., II, 12–16."},  //пн - седмица 20
-            ApEvReads{ 0XF21, "Флп., 242 зач., II, 16–23."},  //вт
-            ApEvReads{ 0XF31, "Флп., 243 зач., II, 24–30."},  //ср
-            ApEvReads{ 0XF41, "Флп., 244 зач., III, 1–8."},  //чт
-            ApEvReads{ 0XF51, "Флп., 245 зач., III, 8–19."},  //пт
-            ApEvReads{ 0XA81, "2 Кор., 168 зач., I, 8–11."}  //сб
-          },
-    std::array { ApEvReads{ 0XCB1, "Гал., 203 зач., II, 16–20."},  //Неделя 21
-            ApEvReads{ 0XF81, "Флп., 248 зач., IV, 10–23."},  //пн - седмица 21
-            ApEvReads{ 0XF91, "Кол., 249 зач., I, 1–2, 7–11."},  //вт
-            ApEvReads{ 0XFB1, "Кол., 251 зач., I, 18–23."},  //ср
-            ApEvReads{ 0XFC1, "Кол., 252 зач., I, 24–29."},  //чт
-            ApEvReads{ 0XFD1, "Кол., 253 зач., II, 1–7."},  //пт
-            ApEvReads{ 0XAE1, "2 Кор., 174 зач., III, 12–18."}  //сб
-          },
-    std::array { ApEvReads{ 0XD71, "Гал., 215 зач., VI, 11–18."},  //Неделя 22
-            ApEvReads{ 0XFF1, "Кол., 255 зач., II, 13–20."},  //пн - седмица 22
-            ApEvReads{ 0X1001, "Кол., 256 зач., II, 20 – III, 3."},  //вт
-            ApEvReads{ 0X1031, "Кол., 259 зач., III, 17 – IV, 1."},  //ср
-            ApEvReads{ 0X1041, "Кол., 260 зач., IV, 2–9."},  //чт
-            ApEvReads{ 0X1051, "Кол., 261 зач., IV, 10–18."},  //пт
-            ApEvReads{ 0XB21, "2 Кор., 178 зач., V, 1–10."}  //сб
-          },
-    std::array { ApEvReads{ 0XDC1, "Еф., 220 зач., II, 4–10."},  //Неделя 23
-            ApEvReads{ 0X1061, "1 Сол., 262 зач., I, 1–5."},  //пн - седмица 23
-            ApEvReads{ 0X1071, "1 Сол., 263 зач., I, 6–10."},  //вт
-            ApEvReads{ 0X1081, "1 Сол., 264 зач., II, 1–8."},  //ср
-            ApEvReads{ 0X1091, "1 Сол., 265 зач., II, 9–14."},  //чт
-            ApEvReads{ 0X10A1, "1 Сол., 266 зач., II, 14–19."},  //пт
-            ApEvReads{ 0XB91, "2 Кор., 185 зач., VIII, 1–5."}  //сб
-          },
-    std::array { ApEvReads{ 0XDD1, "Еф., 221 зач., II, 14–22."},  //Неделя 24
-            ApEvReads{ 0X10B1, "1 Сол., 267 зач., II, 20 – III, 8."},  //пн - седмица 24
-            ApEvReads{ 0X10C1, "1 Сол., 268 зач., III, 9–13."},  //вт
-            ApEvReads{ 0X10D1, "1 Сол., 269 зач., IV, 1–12."},  //ср
-            ApEvReads{ 0X10F1, "1 Сол., 271 зач., V, 1–8."},  //чт
-            ApEvReads{ 0X1101, "1 Сол., 272 зач., V, 9–13, 24–28."},  //пт
-            ApEvReads{ 0XBF1, "2 Кор., 191 зач., XI, 1–6."}  //сб
-          },
-    std::array { ApEvReads{ 0XE01, "Еф., 224 зач., IV, 1–6."},  //Неделя 25
-            ApEvReads{ 0X1121, "2 Сол., 274 зач., I, 1–10."},  //пн - седмица 25
-            ApEvReads{ 0X1121, "2 Сол., 274 зач., I, 10 - II, 2."},  //вт
-            ApEvReads{ 0X1131, "2 Сол., 275 зач., II, 1–12."},  //ср
-            ApEvReads{ 0X1141, "2 Сол., 276 зач., II, 13 – III, 5."},  //чт
-            ApEvReads{ 0X1151, "2 Сол., 277 зач., III, 6–18."},  //пт
-            ApEvReads{ 0XC71, "Гал., 199 зач., I, 3–10."}  //сб
-          },
-    std::array { ApEvReads{ 0XE51, "Еф., 229 зач., V, 8–19."},  //Неделя 26
-            ApEvReads{ 0X1161, "1 Тим., 278 зач., I, 1–7."},  //пн - седмица 26
-            ApEvReads{ 0X1171, "1 Тим., 279 зач., I, 8–14."},  //вт
-            ApEvReads{ 0X1191, "1 Тим., 281 зач., I, 18–20; II, 8–15."},  //ср
-            ApEvReads{ 0X11B1, "1 Тим., 283 зач., III, 1–13."},  //чт
-            ApEvReads{ 0X11D1, "1 Тим., 285 зач., IV, 4–8, 16."},  //пт
-            ApEvReads{ 0XCD1, "Гал., 205 зач., III, 8–12."}  //сб
-          },
-    std::array { ApEvReads{ 0XE91, "Еф., 233 зач., VI, 10–17."},  //Неделя 27
-            ApEvReads{ 0X11D1, "1 Тим., 285 зач., V, 1-10."},  //пн - седмица 27
-            ApEvReads{ 0X11E1, "1 Тим., 286 зач., V, 11–21."},  //вт
-            ApEvReads{ 0X11F1, "1 Тим., 287 зач., V, 22 – VI, 11."},  //ср
-            ApEvReads{ 0X1211, "1 Тим., 289 зач., VI, 17–21."},  //чт
-            ApEvReads{ 0X1221, "2 Тим., 290 зач., I, 1–2, 8–18."},  //пт
-            ApEvReads{ 0XD51, "Гал., 213 зач., V, 22 – VI, 2."}  //сб
-          },
-    std::array { ApEvReads{ 0XFA1, "Кол., 250 зач., I, 12–18."},  //Неделя 28
-            ApEvReads{ 0X1261, "2 Тим., 294 зач., II, 20–26."},  //пн - седмица 28
-            ApEvReads{ 0X1291, "2 Тим., 297 зач., III, 16 – IV, 4."},  //вт
-            ApEvReads{ 0X12B1, "2 Тим., 299 зач., IV, 9–22."},  //ср
-            ApEvReads{ 0X12C1, "Тит., 300 зач., I, 5 - II, 1."},  //чт
-            ApEvReads{ 0X12D1, "Тит., 301 зач., I, 15 – II, 10."},  //пт
-            ApEvReads{ 0XDA1, "Еф., 218 зач., I, 16–23."}  //сб
-          },
-    std::array { ApEvReads{ 0X1011, "Кол., 257 зач., III, 4-11."},  //Неделя 29
-            ApEvReads{ 0X1341, "Евр., 308 зач., III, 5–11, 17–19."},  //пн - седмица 29
-            ApEvReads{ 0X1361, "Евр., 310 зач., IV, 1–13."},  //вт
-            ApEvReads{ 0X1381, "Евр., 312 зач., V, 11 – VI, 8."},  //ср
-            ApEvReads{ 0X13B1, "Евр., 315 зач., VII, 1–6."},  //чт
-            ApEvReads{ 0X13D1, "Евр., 317 зач., VII, 18–25."},  //пт
-            ApEvReads{ 0XDC1, "Еф., 220 зач., II, 11-13."}  //сб
-          },
-    std::array { ApEvReads{ 0X1021, "Кол., 258 зач., III, 12–16."},  //Неделя 30
-            ApEvReads{ 0X13F1, "Евр., 319 зач., VIII, 7–13."},  //пн - седмица 30
-            ApEvReads{ 0X1411, "Евр., 321 зач., IX, 8–10, 15–23."},  //вт
-            ApEvReads{ 0X1431, "Евр., 323 зач., X, 1–18."},  //ср
-            ApEvReads{ 0X1461, "Евр., 326 зач., X, 35 – XI, 7."},  //чт
-            ApEvReads{ 0X1471, "Евр., 327 зач., XI, 8, 11–16."},  //пт
-            ApEvReads{ 0XE41, "Еф., 228 зач., V, 1–8."}  //сб
-          },
-    std::array { ApEvReads{ 0X1181, "1 Тим., 280 зач., I, 15-17."},  //Неделя 31
-            ApEvReads{ 0X1491, "Евр., 329 зач., XI, 17–23, 27–31."},//пн - седмица 31
-            ApEvReads{ 0X14D1, "Евр., 333 зач., XII, 25–26; XIII, 22–25."},//вт
-            ApEvReads{ 0X321, "Иак., 50 зач., I, 1-18."},  //ср
-            ApEvReads{ 0X331, "Иак., 51 зач., I, 19-27."},  //чт
-            ApEvReads{ 0X341, "Иак., 52 зач., II, 1–13."},  //пт
-            ApEvReads{ 0XF91, "Кол., 249 зач., I, 3-6."}  //сб
-          },
-    std::array { ApEvReads{ 0X11D1, "1 Тим., 285 зач., IV, 9-15."},  //Неделя 32
-            ApEvReads{ 0X351, "Иак., 53 зач., II, 14–26."},  //пн - седмица 32
-            ApEvReads{ 0X361, "Иак., 54 зач., III, 1–10."},  //вт
-            ApEvReads{ 0X371, "Иак., 55 зач., III, 11 – IV, 6."},  //ср
-            ApEvReads{ 0X381, "Иак., 56 зач., IV, 7 – V, 9."},  //чт
-            ApEvReads{ 0X3A1, "1 Пет., 58 зач., I, 1–2, 10–12; II, 6–10."},//пт
-            ApEvReads{ 0X1111, "1 Сол., 273 зач., V, 14–23."}  //сб
-          },
-    std::array { ApEvReads{ 0X1281, "2 Тим., 296 зач., III, 10–15."},  //Неделя 33 о мытари и фарисеи
-            ApEvReads{ 0X3B1, "1 Пет., 59 зач., II, 21 – III, 9."},  //пн - седмица 33
-            ApEvReads{ 0X3C1, "1 Пет., 60 зач., III, 10–22."},  //вт
-            ApEvReads{ 0X3D1, "1 Пет., 61 зач., IV, 1–11."},  //ср
-            ApEvReads{ 0X3E1, "1 Пет., 62 зач., IV, 12 – V, 5."},  //чт
-            ApEvReads{ 0X401, "2 Пет., 64 зач., I, 1–10."},  //пт
-            ApEvReads{ 0X1251, "2 Тим., 293 зач., II, 11–19."}  //сб
-          },
-    std::array { ApEvReads{ 0X871, "1 Кор., 135 зач., VI, 12-20."},  //Неделя 34 о блуднем сыне
-            ApEvReads{ 0X421, "2 Пет., 66 зач., I, 20 – II, 9."},  //пн - седмица 34
-            ApEvReads{ 0X431, "2 Пет., 67 зач., II, 9–22."},  //вт
-            ApEvReads{ 0X441, "2 Пет., 68 зач., III, 1–18."},  //ср
-            ApEvReads{ 0X451, "1 Ин., 69 зач., I, 8 – II, 6."},  //чт
-            ApEvReads{ 0X461, "1 Ин., 70 зач., II, 7–17."},  //пт
-            ApEvReads{ 0X1271, "2 Тим., 295 зач., III, 1–9."}  //сб
-          },
-    std::array { ApEvReads{ 0X8C1, "1 Кор., 140 зач., VIII, 8 – IX, 2."},  //Неделя 35 мясопустная
-            ApEvReads{ 0X471, "1 Ин., 71 зач., II, 18 – III, 10."},  //пн - седмица 35
-            ApEvReads{ 0X481, "1 Ин., 72 зач., III, 10–20."},  //вт
-            ApEvReads{ 0X491, "1 Ин., 73 зач., III, 21 – IV, 6."},  //ср
-            ApEvReads{ 0X4A1, "1 Ин., 74 зач., IV, 20 – V, 21."},  //чт
-            ApEvReads{ 0X4B1, "2 Ин., 75 зач., I, 1–13."},  //пт
-            ApEvReads{ 0X921, "1 Кор., 146 зач., X, 23–28."}  //сб
-          },
-    std::array { ApEvReads{ 0X701, "Рим., 112 зач., XIII, 11 – XIV, 4."},  //Неделя 36 сыропустная
-            ApEvReads{ 0X4C1, "3 Ин., 76 зач., I, 1–15."},  //пн - седмица 36
-            ApEvReads{ 0X4D1, "Иуд., 77 зач., I, 1–10."},  //вт
-            ApEvReads{},  //ср
-            ApEvReads{ 0X4E1, "Иуд., 78 зач., I, 11–25."},  //чт
-            ApEvReads{},  //пт
-            ApEvReads{ 0X731, "Рим., 115 зач., XIV, 19–26."}  //сб
-          }
-  };
-  auto apostol_table1_get_chteniya = [](int8_t n50, int8_t dn) {
-    return ApEvReads(apostol_table_1.at(n50).at(dn));
-  };
-  //таблица рядовых чтений на литургии из приложения богосл.евангелия. период от начала вел.поста до Троицкая суб.вкл.
-  //асс.массив, где first - константа-признак даты (блок 1 - переходящие дни года)
-  static const TT2 evangelie_table_2 {
-    {1,    { 0X15, "Ин., 1 зач., I, 1–17." } },//пасха
-    {2,    { 0X25, "Ин., 2 зач., I, 18–28." } },
-    {3,    { 0X714, "Лк., 113 зач., XXIV, 12–35."  } },
-    {4,    { 0X45, "Ин., 4 зач., I, 35–51." } },
-    {5,    { 0X85, "Ин., 8 зач., III, 1–15." } },
-    {6,    { 0X75, "Ин., 7 зач., II, 12–22." } },
-    {7,    { 0XB5, "Ин., 11 зач., III, 22–33." } },
-    {8,    { 0X415, "Ин., 65 зач., XX, 19–31." } },//Неделя 2, о Фоме
-    {9,    { 0X65, "Ин., 6 зач., II, 1–11." } },
-    {10,   { 0XA5, "Ин., 10 зач., III, 16–21." } },
-    {11,   { 0XF5, "Ин., 15 зач., V, 17–24." } },
-    {12,   { 0X105, "Ин., 16 зач., V, 24–30." } },
-    {13,   { 0X115, "Ин., 17 зач., V, 30 – VI, 2." } },
-    {14,   { 0X135, "Ин., 19 зач., VI, 14–27." } },
-    {15,   { 0X453, "Мк., 69 зач., XV, 43–47." } },//Неделя 3, о мироносицах
-    {16,   { 0XD5, "Ин., 13 зач., IV, 46–54." } },
-    {17,   { 0X145, "Ин., 20 зач., VI, 27–33." } },
-    {18,   { 0X155, "Ин., 21 зач., VI, 35–39." } },
-    {19,   { 0X165, "Ин., 22 зач., VI, 40–44." } },
-    {20,   { 0X175, "Ин., 23 зач., VI, 48–54." } },
-    {21,   { 0X345, "Ин., 52 зач., XV, 17 – XVI, 2." } },
-    {22,   { 0XE5, "Ин., 14 зач., V, 1–15." } },//Неделя 4, о разслабленнем
-    {23,   { 0X185, "Ин., 24 зач., VI, 56–69." } },
-    {24,   { 0X195, "Ин., 25 зач., VII, 1–13." } },
-    {25,   { 0X1A5, "Ин., 26 зач., VII, 14–30." } },
-    {26,   { 0X1D5, "Ин., 29 зач., VIII, 12–20." } },
-    {27,   { 0X1E5, "Ин., 30 зач., VIII, 21–30." } },
-    {28,   { 0X1F5, "Ин., 31 зач., VIII, 31–42." } },
-    {29,   { 0XC5, "Ин., 12 зач., IV, 5–42." } },//Неделя 5, о самаряныни
-    {30,   { 0X205, "Ин., 32 зач., VIII, 42–51." } },
-    {31,   { 0X215, "Ин., 33 зач., VIII, 51–59." } },
-    {32,   { 0X125, "Ин., 18 зач., VI, 5–14." } },
-    {33,   { 0X235, "Ин., 35 зач., IX, 39 – X, 9." } },
-    {34,   { 0X255, "Ин., 37 зач., X, 17–28." } },
-    {35,   { 0X265, "Ин., 38 зач., X, 27–38." } },
-    {36,   { 0X225, "Ин., 34 зач., IX, 1–38." } },//Неделя 6, о слепом
-    {37,   { 0X285, "Ин., 40 зач., XI, 47–57." } },
-    {38,   { 0X2A5, "Ин., 42 зач., XII, 19–36." } },
-    {39,   { 0X2B5, "Ин., 43 зач., XII, 36–47." } },
-    {40,   { 0X724, "Лк., 114 зач., XXIV, 36–53."  } },//Вознесение Господне
-    {41,   { 0X2F5, "Ин., 47 зач., XIV, 1–11." } },
-    {42,   { 0X305, "Ин., 48 зач., XIV, 10–21." } },
-    {43,   { 0X385, "Ин., 56 зач., XVII, 1–13." } },//Неделя 7, святых отец
-    {44,   { 0X315, "Ин., 49 зач., XIV, 27 – XV, 7." } },
-    {45,   { 0X355, "Ин., 53 зач., XVI, 2–13." } },
-    {46,   { 0X365, "Ин., 54 зач., XVI, 15–23." } },
-    {47,   { 0X375, "Ин., 55 зач., XVI, 23–33." } },
-    {48,   { 0X395, "Ин., 57 зач., XVII, 18–26." } },
-    {49,   { 0X435, "Ин., 67 зач., XXI, 15–25." } },
-    {92,   { 0XA3, "Мк., 10 зач., II, 23 – III, 5." } },//Суббота первая поста
-    {93,   { 0X55, "Ин., 5 зач., I, 43–51." } },//Неделя первая поста
-    {99,   { 0X63, "Мк., 6 зач., I, 35–44." } },//Суббота вторая поста
-    {100,  { 0X73, "Мк., 7 зач., II, 1–12." } },//Неделя вторая поста
-    {106,  { 0X83, "Мк., 8 зач., II, 14–17." } },//Суббота третия поста
-    {107,  { 0X253, "Мк., 37 зач., VIII, 34 – IX, 1." } },//Неделя третия поста
-    {113,  { 0X1F3, "Мк., 31 зач., VII, 31–37." } },//Суббота четвертая поста
-    {114,  { 0X283, "Мк., 40 зач., IX, 17–31." } },//Неделя четвертая постa
-    {120,  { 0X233, "Мк., 35 зач., VIII, 27–31." } },//Суббота пятая поста
-    {121,  { 0X2F3, "Мк., 47 зач., X, 32–45." } },//Неделя пятая поста
-    {127,  { 0X275, "Ин., 39 зач., XI, 1–45." } },//Суббота шестая Лазарева
-    {128,  { 0X295, "Ин., 41 зач., XII, 1–18." } },//В неделю цветоносную
-    {129,  { 0X622, "Мф., 98 зач., XXIV, 3–35." } },//великий Понедельник
-    {130,  { 0X662, "Мф., 102 зач., XXIV, 36 - XXVI, 2." } },//великий Вторник
-    {131,  { 0X6C2, "Мф., 108 зач., XXVI, 6-16." } },//великую Среду
-    {132,  { 0X6B2, "Мф., 107 зач., XXVI, 1–20. Ин., 44 зач., XIII, 3–17. Мф., 108 зач.(от полу́), XXVI, 21–39. Лк., 109 зач., XXII, 43–45. Мф., 108 зач., XXVI, 40 – XXVII, 2." } },//великий Четверток
-    {134,  { 0X732, "Мф., 115 зач., XXVIII, 1–20." } } //великую Субботу
-  };
-  auto evangelie_table2_get_chteniya = [](const std::set<uint16_t>& markers)->ApEvReads {
-    if(markers.empty()) return ApEvReads();
-    std::vector<uint16_t> t_(evangelie_table_2.size());
-    std::transform(evangelie_table_2.cbegin(), evangelie_table_2.cend(),
-                    t_.begin(),
-                    [](const auto& e){ return e.first; });
-    auto fr1 = std::find_first_of(markers.begin(), markers.end(), t_.begin(), t_.end());
-    if(fr1==markers.end()) return ApEvReads();
-    if(auto fr2 = evangelie_table_2.find(*fr1); fr2 != evangelie_table_2.end()) {
-      return ApEvReads(fr2->second);
-    } else {
-      return ApEvReads();
-    }
-  };
-  //таблица рядовых чтений на литургии из приложения богосл.апостола. период от начала вел.поста до Троицкая суб.вкл.
-  //асс.массив, где first - константа-признак даты (блок 1 - переходящие дни года)
-  static const TT2 apostol_table_2 {
-    {1,    { 0X11, "Деян., 1 зач., I, 1–8." } },   //пасха
-    {2,    { 0X21, "Деян., 2 зач., I, 12–17, 21–26." } },
-    {3,    { 0X41, "Деян., 4 зач., II, 14–21." } },
-    {4,    { 0X51, "Деян., 5 зач., II, 22–36." } },
-    {5,    { 0X61, "Деян., 6 зач., II, 38–43." } },
-    {6,    { 0X71, "Деян., 7 зач., III, 1–8." } },
-    {7,    { 0X81, "Деян., 8 зач., III, 11–16." } },
-    {8,    { 0XE1, "Деян., 14 зач., V, 12–20." } },//Неделя 2, о Фоме
-    {9,    { 0X91, "Деян., 9 зач., III, 19–26." } },
-    {10,   { 0XA1, "Деян., 10 зач., IV, 1–10." } },
-    {11,   { 0XB1, "Деян., 11 зач., IV, 13–22." } },
-    {12,   { 0XC1, "Деян., 12 зач., IV, 23–31." } },
-    {13,   { 0XD1, "Деян., 13 зач., V, 1–11." } },
-    {14,   { 0XF1, "Деян., 15 зач., V, 21–33." } },
-    {15,   { 0X101, "Деян., 16 зач., VI, 1-7." } },//Неделя 3, о мироносицах
-    {16,   { 0X111, "Деян., 17 зач., VI, 8 – VII, 5, 47–60." } },
-    {17,   { 0X121, "Деян., 18 зач., VIII, 5–17." } },
-    {18,   { 0X131, "Деян., 19 зач., VIII, 18–25." } },
-    {19,   { 0X141, "Деян., 20 зач., VIII, 26–39." } },
-    {20,   { 0X151, "Деян., 21 зач., VIII, 40 – IX, 19." } },
-    {21,   { 0X161, "Деян., 22 зач., IX, 19–31." } },
-    {22,   { 0X171, "Деян., 23 зач., IX, 32-42." } },//Неделя 4, о разслабленнем
-    {23,   { 0X181, "Деян., 24 зач., X, 1–16." } },
-    {24,   { 0X191, "Деян., 25 зач., X, 21–33." } },
-    {25,   { 0X221, "Деян., 34 зач., XIV, 6–18." } },
-    {26,   { 0X1A1, "Деян., 26 зач., X, 34–43." } },
-    {27,   { 0X1B1, "Деян., 27 зач., X, 44 – XI, 10." } },
-    {28,   { 0X1D1, "Деян., 29 зач., XII, 1–11." } },
-    {29,   { 0X1C1, "Деян., 28 зач., XI, 19–26, 29–30." } },//Неделя 5, о самаряныни
-    {30,   { 0X1E1, "Деян., 30 зач., XII, 12–17." } },
-    {31,   { 0X1F1, "Деян., 31 зач., XII, 25 – XIII, 12." } },
-    {32,   { 0X201, "Деян., 32 зач., XIII, 13–24." } },
-    {33,   { 0X231, "Деян., 35 зач., XIV, 20–27." } },
-    {34,   { 0X241, "Деян., 36 зач., XV, 5–34." } },
-    {35,   { 0X251, "Деян., 37 зач., XV, 35–41." } },
-    {36,   { 0X261, "Деян., 38 зач., XVI, 16–34." } },//Неделя 6, о слепом
-    {37,   { 0X271, "Деян., 39 зач., XVII, 1–15." } },
-    {38,   { 0X281, "Деян., 40 зач., XVII, 19-28." } },
-    {39,   { 0X291, "Деян., 41 зач., XVIII, 22–28." } },
-    {40,   { 0X11, "Деян., 1 зач., I, 1–12." } },//Вознесение Господне
-    {41,   { 0X2A1, "Деян., 42 зач., XIX, 1–8." } },
-    {42,   { 0X2B1, "Деян., 43 зач., XX, 7–12." } },
-    {43,   { 0X2C1, "Деян., 44 зач., XX, 16-18, 28-36." } },//Неделя 7, святых отец
-    {44,   { 0X2D1, "Деян., 45 зач., XXI, 8–14." } },
-    {45,   { 0X2E1, "Деян., 46 зач., XXI, 26–32." } },
-    {46,   { 0X2F1, "Деян., 47 зач., XXIII, 1–11." } },
-    {47,   { 0X301, "Деян., 48 зач., XXV, 13–19." } },
-    {48,   { 0X321, "Деян., 50 зач., XXVII, 1–44." } },
-    {49,   { 0X331, "Деян., 51 зач., XXVIII, 1–31." } },
-    {92,   { 0X12F1, "Евр., 303 зач., I, 1–12." } },//Суббота первая поста
-    {93,   { 0X1491, "Евр., 329 зач., XI, 24-26, 32 - XII, 2." } },//Неделя первая поста
-    {99,   { 0X1351, "Евр., 309 зач., III, 12–16." } },//Суббота вторая поста
-    {100,  { 0X1301, "Евр., 304 зач., I, 10 – II, 3." } },//Неделя вторая поста
-    {106,  { 0X1451, "Евр., 325 зач., X, 32–38." } },//Суббота третия поста
-    {107,  { 0X1371, "Евр., 311 зач., IV, 14 – V, 6." } },//Неделя третия поста
-    {113,  { 0X1391, "Евр., 313 зач., VI, 9–12." } },//Суббота четвертая поста
-    {114,  { 0X13A1, "Евр., 314 зач., VI, 13–20." } },//Неделя четвертая постa
-    {120,  { 0X1421, "Евр., 322 зач., IX, 24–28." } },//Суббота пятая поста
-    {121,  { 0X1411, "Евр., 321 зач., IX, 11-14." } },//Неделя пятая поста
-    {127,  { 0X14D1, "Евр., 333 зач., XII, 28 - XIII, 8." } },//Суббота шестая Лазарева
-    {128,  { 0XF71, "Флп., 247 зач., IV, 4-9." } },//В неделю цветоносную
-    {132,  { 0X951, "1 Кор., 149 зач., XI, 23–32." } },//великий Четверток
-    {134,  { 0X5B1, "Рим., 91 зач., VI, 3–11." } }//великую Субботу
-
-  };
-  auto apostol_table2_get_chteniya = [](const std::set<uint16_t>& markers)->ApEvReads {
-    if(markers.empty()) return ApEvReads();
-    std::vector<uint16_t> t_(apostol_table_2.size());
-    std::transform(apostol_table_2.cbegin(), apostol_table_2.cend(),
-                    t_.begin(),
-                    [](const auto& e){ return e.first; });
-    auto fr1 = std::find_first_of(markers.begin(), markers.end(), t_.begin(), t_.end());
-    if(fr1==markers.end()) return ApEvReads();
-    if(auto fr2 = apostol_table_2.find(*fr1); fr2 != apostol_table_2.end()) {
-      return ApEvReads(fr2->second);
-    } else {
-      return ApEvReads();
-    }
-  };
-  //prepare second ctor parameter
-  std::array<int,5> zimn_otstupka_n5;
-  std::array<int,4> zimn_otstupka_n4;
-  std::array<int,3> zimn_otstupka_n3;
-  std::array<int,2> zimn_otstupka_n2;
-  int               zimn_otstupka_n1;
-  std::array<int,2> osen_otstupka;
-  auto ilit = il.begin();
-  zimn_otstupka_n1 = *ilit; ++ilit;
-  zimn_otstupka_n2[0] = *ilit; ++ilit;
-  zimn_otstupka_n2[1] = *ilit; ++ilit;
-  zimn_otstupka_n3[0] = *ilit; ++ilit;
-  zimn_otstupka_n3[1] = *ilit; ++ilit;
-  zimn_otstupka_n3[2] = *ilit; ++ilit;
-  zimn_otstupka_n4[0] = *ilit; ++ilit;
-  zimn_otstupka_n4[1] = *ilit; ++ilit;
-  zimn_otstupka_n4[2] = *ilit; ++ilit;
-  zimn_otstupka_n4[3] = *ilit; ++ilit;
-  zimn_otstupka_n5[0] = *ilit; ++ilit;
-  zimn_otstupka_n5[1] = *ilit; ++ilit;
-  zimn_otstupka_n5[2] = *ilit; ++ilit;
-  zimn_otstupka_n5[3] = *ilit; ++ilit;
-  zimn_otstupka_n5[4] = *ilit; ++ilit;
-  osen_otstupka   [0] = *ilit; ++ilit;
-  osen_otstupka   [1] = *ilit; ++ilit;
   //ctor internal data structures
   struct DayData {
     int8_t dn;
-    int8_t glas;
-    int8_t n50;
-    ApEvReads apostol;
-    ApEvReads evangelie;
     std::set<uint16_t> day_markers;
-    DayData() : dn{-1}, glas{-1}, n50{-1} {}
-    DayData(int8_t x) : dn{x}, glas{-1}, n50{-1} {}
+    DayData() : dn{-1} {}
+    DayData(int8_t x) : dn{x} {}
   };
   std::map<ShortDate, DayData> days;
   std::multimap<uint16_t, ShortDate> markers;
   const auto pasha_date = pasha_calc(y);
-  const auto pasha_date_pred = pasha_calc(y-1);
-  auto is_visokos = [](const big_int& y) { return (y%4)==0; };
   const bool b = is_visokos(y);
-  const bool b1 = is_visokos(y-1);
   ShortDate nachalo_posta, t1, t2, t3;
   ShortDate dd {pasha_date};
-  int i = 0, j = 0, glas = 8;
-  bool f = false;
-  //карта дней недели пред. года
-  std::map<ShortDate, int8_t> dn_prev;
-  //функц.возвращает кол-во дней в месяце или -1
-  auto get_days_inmonth_ = [](int8_t month, bool leap) -> int8_t {
-    int8_t k{-1};
-    switch(month) {
-      case 1: { k = 31; }
-          break;
-      case 2: { k = (leap ? 29 : 28); }
-          break;
-      case 3: { k = 31; }
-          break;
-      case 4: { k = 30; }
-          break;
-      case 5: { k = 31; }
-          break;
-      case 6: { k = 30; }
-          break;
-      case 7: { k = 31; }
-          break;
-      case 8: { k = 31; }
-          break;
-      case 9: { k = 30; }
-          break;
-      case 10:{ k = 31; }
-          break;
-      case 11:{ k = 30; }
-          break;
-      case 12:{ k = 31; }
-    };
-    return k;
-  };
-  //функц.возвращает дату увеличенную на кол-во дней доконца года
-  //если инкремент переходит через конец года, возвращает исходную дату
-  //date.first - месяц; date.second - день
-  auto increment_date_ = [&get_days_inmonth_](ShortDate date, int days, bool visokos) -> ShortDate {
-    ShortDate r {date};
-    ShortDate l {date};
-    if(days<1) { return l; }
-    if(date.first<1 || date.first>12)  { return l; }
-    int u = get_days_inmonth_(date.first, visokos);
-    if(date.second<1 || date.second>u) { return l; }
-    r.second += days;
-    while (r.second>u) {
-      r.second = r.second - u;
-      r.first++;
-      if(r.first>12) return l;
-      u = get_days_inmonth_(r.first, visokos);
-    }
-    return r;
-  };
-  //функц.возвращает дату уменьшенную на кол-во дней до начала года
-  //если декремент переходит через начало года, возвращает исходную дату
-  //date.first - месяц; date.second - день
-  auto decrement_date_ = [&get_days_inmonth_](ShortDate date, int days, bool visokos) -> ShortDate {
-    ShortDate r {date};
-    ShortDate l {date};
-    if(days<1) { return l; }
-    if(date.first<1 || date.first>12)  { return l; }
-    int u = get_days_inmonth_(date.first, visokos);
-    if(date.second<1 || date.second>u) { return l; }
-    r.second = r.second - days;
-    while (r.second < 1) {
-      r.first--;
-      if(r.first<1) return l;
-      u = get_days_inmonth_(r.first, visokos);
-      r.second = u + r.second;
-    }
-    return r;
-  };
-  //функц.создание карты дней недели указанного года в формате:
-  //key - дата; key.first - месяц; key.second - день
-  //value - деньнедели; 0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб.
-  auto create_days_map_ = [&increment_date_, &decrement_date_, &is_visokos, this]
-                          (const big_int& y) -> std::optional<std::map<ShortDate, int8_t>>
-  {
-    if(y<1) return std::nullopt;
-    const bool b = is_visokos(y);
-    const auto pasha_date = pasha_calc(y) ;
-    ShortDate data1, data2;
-    std::map<ShortDate, int8_t> result;
-    int i = 0;
-    while (i<7) {
-      data1 = increment_date_(pasha_date, i, b);
-      data2 = increment_date_(data1, 7, b);
-      result.insert({data1, i});
-      while (data1 != data2) {
-        result.insert({data2, i});
-        data1 = data2;
-        data2 = increment_date_(data1, 7, b);
-      }
-      data1 = decrement_date_(pasha_date, 7-i, b);
-      if(data1 != pasha_date) result.insert({data1, i});
-      data2 = decrement_date_(data1, 7, b);
-      while (data2 != data1) {
-        result.insert({data2, i});
-        data1 = data2;
-        data2 = decrement_date_(data1, 7, b);
-      }
-      i++;
-    }
-    return result;
-  };
+  int i = 0;
   //функц.установка признака для даты
   auto add_marker_for_date_ = [&days, &markers](const ShortDate& d, oxc_const m){
     #ifdef NDEBUG
@@ -2359,10 +2647,6 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     if(auto e = days.find(d); e!=days.end()) return e->second.dn;
     else return -1;
   };
-  auto get_dn_prev_year = [&dn_prev](const ShortDate& d)->int8_t{
-    if(auto e = dn_prev.find(d); e!=dn_prev.end()) return e->second;
-    else return -1;
-  };
   //функц.проверки даты на признак
   auto check_date_ = [&days](const ShortDate& d, oxc_const m){
     if(auto fr = days.find(d); fr!=days.end()) {
@@ -2379,44 +2663,12 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
       return ShortDate(-1, -1);
     }
   };
-  //функц.установка гласа для даты
-  auto set_glas_ = [&days](const ShortDate& d, const int8_t glas){
-    if(auto fr = days.find(d); fr!=days.end()) {
-      fr->second.glas = glas;
-    } else { assert((void("element not found"), false)); }
-  };
-  //функц.установка евангелия для даты
-  auto set_evangelie_ = [&days](const ShortDate& d, const ApEvReads& ev){
-    if(auto fr = days.find(d); fr!=days.end()) {
-      fr->second.evangelie = ev;
-    } else { assert((void("element not found"), false)); }
-  };
-  //функц.установка апостола для даты
-  auto set_apostol_ = [&days](const ShortDate& d, const ApEvReads& ap){
-    if(auto fr = days.find(d); fr!=days.end()) {
-      fr->second.apostol = ap;
-    } else { assert((void("element not found"), false)); }
-  };
-  //функц.установка номер по пятидесятнице для даты
-  auto set_n50_ = [&days](const ShortDate& d, const int8_t n){
-    if(auto fr = days.find(d); fr!=days.end()) {
-      fr->second.n50 = n;
-    } else { assert((void("element not found"), false)); }
-  };
-  //функц.поиск номер по пятидесятнице для даты
-  auto get_n50_ = [&days](const ShortDate& d)->int8_t{
-    if(auto e = days.find(d); e!=days.end()) return e->second.n50;
-    else return -1;
-  };
-  //создание карт дней недели всего года
+  //создание карты дней недели всего года
   if(auto x = create_days_map_(y)) {
     std::transform(x->cbegin(), x->cend(), std::inserter(days, days.end()), [](const auto& e){
       return std::make_pair(e.first, DayData{e.second});
     });
   }
-  if(auto x = create_days_map_(y-1)) {
-    dn_prev = std::move(*x);
-  }
   //расчет дат непереходящих праздников
   for(auto it = stable_dates.begin(); it != stable_dates.end(); it = std::next(it,3)) {
     add_marker_for_date_(ShortDate(*std::next(it), *std::next(it,2)), *it);
@@ -3132,7 +3384,7 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
       default: { add_marker_for_date_(dd, sub_peredbogoyav_r); }
     };
   }
-  i = get_dn_prev_year(make_pair(12,25)) ;
+  i = get_dn_prev_year_(make_pair(12,25)) ;
   if(!(i==0 || i==1)) {
     switch(i) {
       case 2: { dd = make_pair(1,5); } break;
@@ -3457,6 +3709,59 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
   add_marker_for_date_(get_date_(m6d29),   vel_prazd);
   add_marker_for_date_(get_date_(m8d29),   vel_prazd);
   add_marker_for_date_(get_date_(m10d1),   vel_prazd);
+  //save data to object
+  assert(days.size() == (b ? 366u : 365u));
+  std::size_t markers_count{};
+  for(const auto& [date, x]: days) markers_count += x.day_markers.size();
+  markers_pool.reserve(markers_count);
+  int k{};
+  for(const auto& [date, x]: days) {
+    days_hot[k].dn = x.dn;
+    markers_offs[k] = static_cast<uint16_t>(markers_pool.size());
+    markers_pool.insert(markers_pool.end(), x.day_markers.begin(), x.day_markers.end());
+    k++;
+  }
+  std::fill(markers_offs.begin()+k, markers_offs.end(), static_cast<uint16_t>(markers_pool.size()));
+  //обратный индекс признак -> дни года (сортировка подсчетом)
+  for(auto m: markers_pool) {
+    assert(marker_index(m)>=0);
+    dates_offs[marker_index(m)+1]++;
+  }
+  std::partial_sum(dates_offs.begin(), dates_offs.end(), dates_offs.begin());
+  dates_pool.resize(markers_pool.size());
+  auto pos {dates_offs};
+  for(int i=0; i<k; i++) {
+    for(auto m: day_markers_(i)) dates_pool[pos[marker_index(m)]++] = static_cast<uint16_t>(i);
+  }
+  if(this->metrics) this->metrics->built(BuildPhase::markers, std::chrono::steady_clock::now() - build_start);
+}//end OrthYear ctor
+
+void OrthYear::run_phase_(BuildPhase phase, void (OrthYear::*build)() const) const
+{
+  const auto start = std::chrono::steady_clock::now();
+  (this->*build)();
+  if(metrics) metrics->built(phase, std::chrono::steady_clock::now() - start);
+}
+
+void OrthYear::build_glas_() const
+{ //расчет гласов каждого дня года
+  auto make_pair = [](int m, int d){ return ShortDate{m,d}; };
+  const auto pasha_date_pred = pasha_calc(y-1);
+  const bool b = is_visokos(y);
+  const bool b1 = is_visokos(y-1);
+  ShortDate t1, t2, t3, dd;
+  int j = 0, glas = 8;
+  bool f = false;
+  //функц.поиск дня недели
+  auto get_dn_ = [this](const ShortDate& d)->int8_t{ return get_date_dn(d.first, d.second); };
+  //функц.поиск даты попризнаку
+  auto get_date_ = [this](oxc_const m)->ShortDate{ return get_date_with(m).value_or(ShortDate(-1, -1)); };
+  //функц.установка гласа для даты
+  auto set_glas_ = [this](const ShortDate& d, const int8_t glas){
+    if(auto k = day_of_year_(d, visokos); k>=0) {
+      days_hot[k].glas = glas;
+    } else { assert((void("element not found"), false)); }
+  };
   //расчет гласов период от субб. лазарева до нед. всех святых
   t1 = get_date_(vel_post_d6n6);//субб лазарева
   t2 = get_date_(ned1_po50);//нед всех святых
@@ -3491,7 +3796,7 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
       t3 = dd;
       dd = increment_date_(dd, 1, b1);
       if(dd==t3) { f = true; break; }
-      j = get_dn_prev_year(dd);
+      j = get_dn_prev_year_(dd);
     } while(j>0);
     if(f || j<0) break;
     glas++;
@@ -3516,14 +3821,39 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     glas++;
     if(glas>8) glas = 1;
   } while(true);
-  //расчет календарный номер по пятидесятнице каждого дня года
-  t1 = increment_date_(pasha_date_pred, 49, b1);
+}
+
+void OrthYear::build_n50_() const
+{ //расчет календарный номер по пятидесятнице каждого дня года
+  //и кол-во седмиц отступки/преступки чтений
+  auto make_pair = [](int m, int d){ return ShortDate{m,d}; };
+  const auto pasha_date_pred = pasha_calc(y-1);
+  const bool b = is_visokos(y);
+  const bool b1 = is_visokos(y-1);
+  ShortDate nachalo_posta, t1, t2, t3, dd;
+  int i = 0;
+  //функц.поиск дня недели
+  auto get_dn_ = [this](const ShortDate& d)->int8_t{ return get_date_dn(d.first, d.second); };
+  //функц.поиск даты попризнаку
+  auto get_date_ = [this](oxc_const m)->ShortDate{ return get_date_with(m).value_or(ShortDate(-1, -1)); };
+  //функц.установка номер по пятидесятнице для даты
+  auto set_n50_ = [this](const ShortDate& d, const int8_t n){
+    if(auto k = day_of_year_(d, visokos); k>=0) {
+      days_hot[k].n50 = n;
+    } else { assert((void("element not found"), false)); }
+  };
+  //функц.поиск номер по пятидесятнице для даты
+  auto get_n50_ = [this](const ShortDate& d)->int8_t{
+    if(auto k = day_of_year_(d, visokos); k>=0) return days_hot[k].n50;
+    else return -1;
+  };
+  t1 = increment_date_(pasha_date_pred, 49, b1);
   i = 0;
   while(true) {
     t2 = increment_date_(t1, 1, b1);
     if(t2!=t1) { t1 = t2; }
     else       { break; }
-    if(get_dn_prev_year(t1)==1) i++; //i = номер для 31дек. пред. года
+    if(get_dn_prev_year_(t1)==1) i++; //i = номер для 31дек. пред. года
   }
   t1 = make_pair(1, 1);
   if(get_dn_(t1)==1) i++;//i = номер для 1янв. текущ. года
@@ -3548,33 +3878,26 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     else       { break; }
     if(get_dn_(t1)==1) i++;
   }
-  //расчет рядовые чтения евангелия на литургии
-  i = j = 0;
-  std::vector<int> v, w, v1, w1;//контейнеры для номеров доб.седмиц и недель
-  t1 = make_pair(1, 1);
+  //расчет кол-во седмиц осенней отступки/преступки пред. и текущего года
+  i = 0;
   t3 = make_pair(9, 15);
-  dd = get_date_(ned_mitar_ifaris);
-  auto ddd = increment_date_(pasha_date_pred, 49, b1);//пятидесятницa пред. года
-  auto d2 {get_date_(ned_pobogoyav)};
-  auto mf7  {increment_date_(dd,7,b)};
-  auto mf14 {increment_date_(dd,14,b)};
-  auto mf21 {increment_date_(dd,21,b)};
-  auto ned_po_vozdv {get_date_(ned_po14sent)};
-  auto dd1 {decrement_date_(ned_po_vozdv, 14, b)};
-  auto dd2 {decrement_date_(ned_po_vozdv,  7, b)};
-  const int kdn {get_dn_({1, 6})};
+  dd = increment_date_(pasha_date_pred, 49, b1);//пятидесятницa пред. года
   while (true) {//поиск t3 = датa недели по воздвижении пред. года
-    int q{ get_dn_prev_year(t3) };
+    int q{ get_dn_prev_year_(t3) };
     if(q==0) { break; }
     t3 = increment_date_(t3, 1, b1);
   }
   do {//поиск i = календарный номер t3 по пятидесятнице пред. года
-    ddd = increment_date_(ddd, 7, b1);
+    dd = increment_date_(dd, 7, b1);
     i++;
-  } while(ddd!=t3);
-  int sn   {17-i};//кол-во седмиц осенней отступки/преступки  пред. года
-  int osen {17 - get_n50_(ned_po_vozdv)};//тоже для текущего года
-  int zimn {};//расчет кол-во седмиц зимней отступки (А.Кашкин - стр.126)
+  } while(dd!=t3);
+  spring_indent_prev = 17-i;
+  spring_indent = 17 - get_n50_(get_date_(ned_po14sent));
+  //расчет кол-во седмиц зимней отступки (А.Кашкин - стр.126)
+  int zimn {};
+  dd = get_date_(ned_mitar_ifaris);
+  const auto d2 {get_date_(ned_pobogoyav)};
+  const int kdn {get_dn_({1, 6})};
   if( !(dd==d2 && kdn!=0 && kdn!=1) ) {
     if( dd==d2 && (kdn==0||kdn==1) ) zimn--;
     if( dd!=d2 ) {
@@ -3586,6 +3909,142 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
       }
     }
   }
+  winter_indent = zimn;
+}
+
+void OrthYear::build_readings_() const
+{ //расчет рядовые чтения апостола и евангелия на литургии
+  require_n50_();
+  //функции возвращают идентификатор чтения (см. reading_by_id)
+  auto evangelie_table1_get_chteniya = [](int8_t n50, int8_t dn)->uint16_t {
+    evangelie_table_1.at(n50).at(dn);//проверка индексов
+    return READS_EV1 | (n50*7 + dn);
+  };
+  auto apostol_table1_get_chteniya = [](int8_t n50, int8_t dn)->uint16_t {
+    apostol_table_1.at(n50).at(dn);//проверка индексов
+    return READS_AP1 | (n50*7 + dn);
+  };
+  auto evangelie_table2_get_chteniya = [](std::span<const uint16_t> markers)->uint16_t {
+    for(auto m: markers) {
+      if(find_in_table2(evangelie_table_2, evangelie_table2_index, m)) return READS_EV2 | m;
+    }
+    return 0;
+  };
+  auto apostol_table2_get_chteniya = [](std::span<const uint16_t> markers)->uint16_t {
+    for(auto m: markers) {
+      if(find_in_table2(apostol_table_2, apostol_table2_index, m)) return READS_AP2 | m;
+    }
+    return 0;
+  };
+  //функц.расчет воскресного утреннего евангелия для дня k
+  auto resurrect_evangelie_get_chteniya = [this](int k)->uint16_t {
+    auto markers = day_markers_(k);
+    auto w = std::find_first_of(unique_evangelie_table.begin(), unique_evangelie_table.end(),
+                                markers.begin(), markers.end());
+    if( w != unique_evangelie_table.end() ) {
+      switch(*w) {
+        case ned2_popashe:  { return READS_RES | 0; }
+        case ned3_popashe:  { return READS_RES | 2; }
+        case ned4_popashe:  { return READS_RES | 3; }
+        case ned5_popashe:  { return READS_RES | 6; }
+        case ned6_popashe:  { return READS_RES | 7; }
+        case ned7_popashe:  { return READS_RES | 9; }
+        case ned8_popashe:  { return READS_RES | 8; }
+        case vel_post_d0n7: { return READS_HOL | 0; }
+        case m1d6:          { return READS_HOL | 1; }
+        case sretenie:      { return READS_HOL | 2; }
+        case m3d25:         { return READS_HOL | 3; }
+        case m8d6:          { return READS_HOL | 4; }
+        case m8d15:         { return READS_HOL | 3; }
+        case m9d8:          { return READS_HOL | 3; }
+        case m9d14:         { return READS_HOL | 5; }
+        case m11d21:        { return READS_HOL | 3; }
+        case m12d25:        { return READS_HOL | 6; }
+        default:            { return 0; }
+      };
+    } else {
+      auto n50 = days_hot[k].n50;
+      if(n50>0 && n50<12) {
+        return READS_RES | (n50-1);
+      } else if(n50>11) {
+        uint8_t x = n50 % 11;
+        if(x==0) x = 10; else x--;
+        return READS_RES | x;
+      }
+    }
+    return 0;
+  };
+  //prepare indent options
+  std::array<int,5> zimn_otstupka_n5;
+  std::array<int,4> zimn_otstupka_n4;
+  std::array<int,3> zimn_otstupka_n3;
+  std::array<int,2> zimn_otstupka_n2;
+  int               zimn_otstupka_n1;
+  std::array<int,2> osen_otstupka;
+  auto ilit = indent_opts.begin();
+  zimn_otstupka_n1 = *ilit; ++ilit;
+  zimn_otstupka_n2[0] = *ilit; ++ilit;
+  zimn_otstupka_n2[1] = *ilit; ++ilit;
+  zimn_otstupka_n3[0] = *ilit; ++ilit;
+  zimn_otstupka_n3[1] = *ilit; ++ilit;
+  zimn_otstupka_n3[2] = *ilit; ++ilit;
+  zimn_otstupka_n4[0] = *ilit; ++ilit;
+  zimn_otstupka_n4[1] = *ilit; ++ilit;
+  zimn_otstupka_n4[2] = *ilit; ++ilit;
+  zimn_otstupka_n4[3] = *ilit; ++ilit;
+  zimn_otstupka_n5[0] = *ilit; ++ilit;
+  zimn_otstupka_n5[1] = *ilit; ++ilit;
+  zimn_otstupka_n5[2] = *ilit; ++ilit;
+  zimn_otstupka_n5[3] = *ilit; ++ilit;
+  zimn_otstupka_n5[4] = *ilit; ++ilit;
+  osen_otstupka   [0] = *ilit; ++ilit;
+  osen_otstupka   [1] = *ilit; ++ilit;
+  const bool b = is_visokos(y);
+  ShortDate t1, t2, t3, dd;
+  int j = 0;
+  auto make_pair = [](int m, int d){ return ShortDate{m,d}; };
+  //функц.поиск дня недели
+  auto get_dn_ = [this](const ShortDate& d)->int8_t{ return get_date_dn(d.first, d.second); };
+  //функц.поиск даты попризнаку
+  auto get_date_ = [this](oxc_const m)->ShortDate{ return get_date_with(m).value_or(ShortDate(-1, -1)); };
+  //функц.установка евангелия для даты
+  auto set_evangelie_ = [this](const ShortDate& d, const uint16_t ev){
+    if(auto k = day_of_year_(d, visokos); k>=0) {
+      days_cold[k].evangelie = ev;
+    } else { assert((void("element not found"), false)); }
+  };
+  //функц.установка апостола для даты
+  auto set_apostol_ = [this](const ShortDate& d, const uint16_t ap){
+    if(auto k = day_of_year_(d, visokos); k>=0) {
+      days_cold[k].apostol = ap;
+    } else { assert((void("element not found"), false)); }
+  };
+  //функц.поиск номер по пятидесятнице для даты
+  auto get_n50_ = [this](const ShortDate& d)->int8_t{
+    if(auto k = day_of_year_(d, visokos); k>=0) return days_hot[k].n50;
+    else return -1;
+  };
+  //функц.поиск признаков даты
+  auto get_markers_ = [this](const ShortDate& d)->std::span<const uint16_t>{
+    if(auto k = day_of_year_(d, visokos); k>=0) return day_markers_(k);
+    else return {};
+  };
+  //расчет рядовые чтения евангелия на литургии
+  std::vector<int> v, w, v1, w1;//контейнеры для номеров доб.седмиц и недель
+  t1 = make_pair(1, 1);
+  dd = get_date_(ned_mitar_ifaris);
+  ShortDate ddd;//дата начала нового ряда чтений
+  auto d2 {get_date_(ned_pobogoyav)};
+  auto mf7  {increment_date_(dd,7,b)};
+  auto mf14 {increment_date_(dd,14,b)};
+  auto mf21 {increment_date_(dd,21,b)};
+  auto ned_po_vozdv {get_date_(ned_po14sent)};
+  auto dd1 {decrement_date_(ned_po_vozdv, 14, b)};
+  auto dd2 {decrement_date_(ned_po_vozdv,  7, b)};
+  const int kdn {get_dn_({1, 6})};
+  const int sn   {spring_indent_prev};//кол-во седмиц осенней отступки/преступки  пред. года
+  const int osen {spring_indent};//тоже для текущего года
+  const int zimn {winter_indent};//кол-во седмиц зимней отступки
   if(zimn!=0) {//поиск ddd = дата начала нового ряда чтений
     switch(kdn) {
     case 1: {  }
@@ -3630,7 +4089,6 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     default: {}
   };
   v1 = v; w1 = w;//копия для вычислений апостола
-  winter_indent = zimn; spring_indent = osen; //сохранение в объекте
   t3 = get_date_(ned8_popashe);//пятидесятницa
   while(true) {//цикл перебора дат всего года
     j = get_dn_(t1);
@@ -3666,10 +4124,7 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     }
     //период от начала в.поста до троицкой род.субб вкл.
     if(t1>mf21 && t1<t3) {
-      auto fr1 = days.find(t1);
-      if(fr1 != days.end()) {
-        set_evangelie_(t1, evangelie_table2_get_chteniya(fr1->second.day_markers));
-      }
+      set_evangelie_(t1, evangelie_table2_get_chteniya(get_markers_(t1)));
     }
     //период от пятидесятницы до конца года
     if( (t1>=t3 && t1<=dd1) || (t1>dd1 && t1<=ned_po_vozdv && osen>=0) ) {
@@ -3728,10 +4183,7 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     }
     //период от начала в.поста до троицкой род.субб вкл.
     if(t1>mf21 && t1<t3) {
-      auto fr1 = days.find(t1);
-      if(fr1 != days.end()) {
-        set_apostol_(t1, apostol_table2_get_chteniya(fr1->second.day_markers));
-      }
+      set_apostol_(t1, apostol_table2_get_chteniya(get_markers_(t1)));
     }
     //период от пятидесятницы до конца года
     if(t1>=t3) {
@@ -3760,36 +4212,19 @@ OrthYear::OrthYear(const std::string& year, std::span<const uint8_t> il, bool os
     if(t2!=t1) { t1 = t2; }
     else       { break; }
   }
-  //save data to object
-  data1.reserve(days.size());
-  std::for_each(days.begin(), days.end(), [this](const auto& e){
-    Data1 d;
-    d.dn = e.second.dn;
-    d.glas = e.second.glas;
-    d.n50 = e.second.n50;
-    d.day = e.first.second;
-    d.month = e.first.first;
-    d.apostol = e.second.apostol;
-    d.evangelie = e.second.evangelie;
-    std::copy(e.second.day_markers.begin(), e.second.day_markers.end(), d.day_markers.begin());
-    data1.push_back(std::move(d));
-  });
-  data2.reserve(markers.size());
-  std::for_each(markers.begin(), markers.end(), [this](const auto& e){
-    Data2 d;
-    d.marker = e.first;
-    d.day = e.second.second;
-    d.month = e.second.first;
-    data2.push_back(std::move(d));
-  });
-  data1.shrink_to_fit();
-  data2.shrink_to_fit();
-}//end OrthYear ctor
+  //расчет воскресные утренние евангелия
+  const int days_count = b ? 366 : 365;
+  for(int k=0; k<days_count; k++) {
+    if(days_hot[k].dn==0) days_cold[k].resurrect = resurrect_evangelie_get_chteniya(k);
+  }
+}
+
 
 int8_t OrthYear::get_date_glas(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    return fr.value()->glas;
+  require_glas_();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return days_hot[k].glas;
   } else {
     return -1;
   }
@@ -3797,8 +4232,9 @@ int8_t OrthYear::get_date_glas(int8_t month, int8_t day) const
 
 int8_t OrthYear::get_date_n50(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    return fr.value()->n50;
+  require_n50_();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return days_hot[k].n50;
   } else {
     return -1;
   }
@@ -3806,8 +4242,8 @@ int8_t OrthYear::get_date_n50(int8_t month, int8_t day) const
 
 int8_t OrthYear::get_date_dn(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    return fr.value()->dn;
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return days_hot[k].dn;
   } else {
     return -1;
   }
@@ -3815,8 +4251,9 @@ int8_t OrthYear::get_date_dn(int8_t month, int8_t day) const
 
 ApEvReads OrthYear::get_date_apostol(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    return fr.value()->apostol;
+  require_readings_();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return reading_by_id(days_cold[k].apostol);
   } else {
     return {};
   }
@@ -3824,8 +4261,9 @@ ApEvReads OrthYear::get_date_apostol(int8_t month, int8_t day) const
 
 ApEvReads OrthYear::get_date_evangelie(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    return fr.value()->evangelie;
+  require_readings_();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return reading_by_id(days_cold[k].evangelie);
   } else {
     return {};
   }
@@ -3833,160 +4271,644 @@ ApEvReads OrthYear::get_date_evangelie(int8_t month, int8_t day) const
 
 ApEvReads OrthYear::get_resurrect_evangelie(int8_t month, int8_t day) const
 {
-  auto dn = get_date_dn(month, day);
-  if(dn != 0) return {};
-  //таблица 11-и воскресныx утрених евангелий
-  static const std::array resurrect_evangelie_table = {
-    ApEvReads{ 0X742,  "Мф., 116 зач., XXVIII, 16–20." },
-    ApEvReads{ 0X463 , "Мк., 70 зач., XVI, 1–8." },
-    ApEvReads{ 0X473 , "Мк., 71 зач., XVI, 9–20." },
-    ApEvReads{ 0X704,  "Лк., 112 зач., XXIV, 1–12." },
-    ApEvReads{ 0X714,  "Лк., 113 зач., XXIV, 12–35." },
-    ApEvReads{ 0X724,  "Лк., 114 зач., XXIV, 36–53." },
-    ApEvReads{ 0X3f5 , "Ин., 63 зач., XX, 1–10." },
-    ApEvReads{ 0X405 , "Ин., 64 зач., XX, 11–18." },
-    ApEvReads{ 0X415 , "Ин., 65 зач., XX, 19–31." },
-    ApEvReads{ 0X425 , "Ин., 66 зач., XXI, 1–14." },
-    ApEvReads{ 0X435 , "Ин., 67 зач., XXI, 15–25." }
-  };
-  //таблица праздничных утрених евангелий
-  static const std::array holydays_evangelie_table = {
-    ApEvReads{ 0X532, "Мф., 83 зач., XXI, 1–11, 15–17." },//Вербное воскресенье
-    ApEvReads{ 0X23,  "Мк., 2 зач., I, 9–11." },          //Крещение
-    ApEvReads{ 0X84,  "Лк., 8 зач., II, 25–32."},         //Сре́тение
-    ApEvReads{ 0X44,  "Лк., 4 зач., I, 39–49, 56."},      //Благовещ́ение, Успе́ние, Рождество, Введе́ние Пресв.Богородицы
-    ApEvReads{ 0X2d4, "Лк., 45 зач., IX, 28–36."},        //Преображение
-    ApEvReads{ 0X2a5, "Ин., 42 зач., XII, 28-36."},       //Воздви́жение
-    ApEvReads{ 0X22,  "Мф., 2 зач., I, 18–25."}           //Рождество
-  };
-  static const std::array unique_evangelie_table = {
-    ned2_popashe,
-    ned3_popashe,
-    ned4_popashe,
-    ned5_popashe,
-    ned6_popashe,
-    ned7_popashe,
-    ned8_popashe,
-    vel_post_d0n7,
-    m1d6,
-    sretenie,
-    m3d25,
-    m8d6,
-    m8d15,
-    m9d8,
-    m9d14,
-    m11d21,
-    m12d25
-  };
-  auto w = unique_evangelie_table.end();
-  if( auto date_properties = get_date_properties(month, day); date_properties ) {
-    w = std::find_first_of(unique_evangelie_table.begin(),
-                              unique_evangelie_table.end(),
-                              date_properties->begin(),
-                              date_properties->end());
-  }
-  if( w != unique_evangelie_table.end() ) {
-    switch(*w) {
-      case ned2_popashe:  { return resurrect_evangelie_table[0]; }
-      case ned3_popashe:  { return resurrect_evangelie_table[2]; }
-      case ned4_popashe:  { return resurrect_evangelie_table[3]; }
-      case ned5_popashe:  { return resurrect_evangelie_table[6]; }
-      case ned6_popashe:  { return resurrect_evangelie_table[7]; }
-      case ned7_popashe:  { return resurrect_evangelie_table[9]; }
-      case ned8_popashe:  { return resurrect_evangelie_table[8]; }
-      case vel_post_d0n7: { return holydays_evangelie_table[0]; }
-      case m1d6:          { return holydays_evangelie_table[1]; }
-      case sretenie:      { return holydays_evangelie_table[2]; }
-      case m3d25:         { return holydays_evangelie_table[3]; }
-      case m8d6:          { return holydays_evangelie_table[4]; }
-      case m8d15:         { return holydays_evangelie_table[3]; }
-      case m9d8:          { return holydays_evangelie_table[3]; }
-      case m9d14:         { return holydays_evangelie_table[5]; }
-      case m11d21:        { return holydays_evangelie_table[3]; }
-      case m12d25:        { return holydays_evangelie_table[6]; }
-      default:            { return {}; }
-    };
+  require_readings_();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    return reading_by_id(days_cold[k].resurrect);
   } else {
-    auto n50 = get_date_n50(month, day);
-    if(n50>0 && n50<12) {
-      return resurrect_evangelie_table[n50-1] ;
-    } else if(n50>11) {
-      uint8_t x = n50 % 11;
-      if(x==0) x = 10; else x--;
-      return resurrect_evangelie_table[x] ;
-    }
+    return {};
   }
-  return {};
 }
 
 std::optional<std::vector<uint16_t>> OrthYear::get_date_properties(int8_t month, int8_t day) const
 {
-  if(auto fr = find_in_data1(month, day); fr) {
-    std::vector<uint16_t> res ;
-    std::copy_if(fr.value()->day_markers.begin(), fr.value()->day_markers.end(),
-                  std::back_inserter(res),
-                  [](auto x){ return x>0; });
-    if(res.empty()) return std::nullopt;
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    auto x = day_markers_(k);
+    if(x.empty()) return std::nullopt;
+    std::vector<uint16_t> res (x.begin(), x.end());
     return res;
   } else {
     return std::nullopt;
   }
 }
 
-std::optional<ShortDate> OrthYear::get_date_with(uint16_t m) const
+DayInfo OrthYear::get_day_info(int8_t month, int8_t day) const
+{
+  DayInfo res;
+  build_all();
+  if(auto k = day_of_year_({month, day}, visokos); k>=0) {
+    res.glas = days_hot[k].glas;
+    res.n50 = days_hot[k].n50;
+    res.apostol = reading_by_id(days_cold[k].apostol);
+    res.evangelie = reading_by_id(days_cold[k].evangelie);
+    res.resurrect_evangelie = reading_by_id(days_cold[k].resurrect);
+    auto x = day_markers_(k);
+    if(x.size() > res.properties_data.size()) throw std::runtime_error("превышено допустимое число свойств даты");
+    std::copy(x.begin(), x.end(), res.properties_data.begin());
+    res.properties_count = static_cast<uint8_t>(x.size());
+  }
+  return res;
+}
+
+template<typename F>
+  void OrthYear::for_each_day(ShortDate from, ShortDate to, F f) const
+{ //передает f данные дней года from...to (включительно); поля даты в DayView заполняет вызывающий
+  build_all();
+  const int k1 = day_of_year_(from, visokos);
+  const int k2 = day_of_year_(to, visokos);
+  if(k1 < 0 || k2 < 0) return;
+  DayView v;
+  for(int k = k1; k <= k2; k++) {
+    v.weekday = days_hot[k].dn;
+    v.glas = days_hot[k].glas;
+    v.n50 = days_hot[k].n50;
+    v.properties = day_markers_(k);
+    v.apostol = reading_by_id(days_cold[k].apostol);
+    v.evangelie = reading_by_id(days_cold[k].evangelie);
+    v.resurrect_evangelie = reading_by_id(days_cold[k].resurrect);
+    f(v);
+  }
+}
+
+std::span<const uint16_t> OrthYear::get_days_with(uint16_t m) const
+{ //возвращает порядковые номера дней года (по возрастанию) с признаком m
+  const int i = marker_index(m);
+  if(i<0) return {};
+  return std::span(dates_pool).subspan(dates_offs[i], dates_offs[i+1]-dates_offs[i]);
+}
+
+std::optional<ShortDate> OrthYear::get_date_with(uint16_t m, ShortDate from, ShortDate to) const
 {
-  if(m<1) return std::nullopt;
-  auto fr = std::lower_bound(data2.begin(), data2.end(), m);
-  if(fr==data2.end()) return std::nullopt;
-  if( !(*fr==m) ) return std::nullopt;
-  return ShortDate{fr->month, fr->day};
+  const int k1 = day_of_year_(from, visokos);
+  const int k2 = day_of_year_(to, visokos);
+  if(k1<0 || k2<0) return std::nullopt;
+  auto x = get_days_with(m);
+  auto it = std::lower_bound(x.begin(), x.end(), k1);
+  if(it == x.end() || *it > k2) return std::nullopt;
+  return date_of_year_(*it, visokos);
 }
 
 std::optional<std::vector<ShortDate>> OrthYear::get_alldates_with(uint16_t m) const
 {
-  if(m<1) return std::nullopt;
-  auto [begin, end] = std::equal_range(data2.begin(), data2.end(), m);
-  if(begin==data2.end()) return std::nullopt;
+  auto x = get_days_with(m);
+  if(x.empty()) return std::nullopt;
   std::vector<ShortDate> res ;
-  std::transform(begin, end, std::back_inserter(res),
-        [](const auto& e){ return ShortDate{e.month, e.day}; });
-  if(res.empty()) return std::nullopt;
+  res.reserve(x.size());
+  std::transform(x.begin(), x.end(), std::back_inserter(res),
+        [this](auto k){ return date_of_year_(k, visokos); });
   return res;
 }
 
-std::optional<ShortDate> OrthYear::get_date_withanyof(std::span<oxc_const> m) const
+std::optional<ShortDate> OrthYear::get_date_withanyof(std::span<oxc_const> m, ShortDate from, ShortDate to) const
 {
   if(m.empty()) return std::nullopt;
-  for(auto i: m) { if(auto x = get_date_with(i); x) return *x; }
+  for(auto i: m) { if(auto x = get_date_with(i, from, to); x) return *x; }
   return std::nullopt;
 }
 
-std::optional<ShortDate> OrthYear::get_date_withallof(std::span<oxc_const> m) const
+std::optional<ShortDate> OrthYear::get_date_withallof(std::span<oxc_const> m, ShortDate from, ShortDate to) const
 {
-  if(m.empty()) return std::nullopt;
-  auto semires = get_alldates_with(m.front());
-  if(!semires) return std::nullopt;
-  for(auto [month, day] : *semires) {
-    const bool b = std::all_of(m.begin(), m.end(), [this, month, day](auto x){
-      auto fr = find_in_data1(month, day);
-      return std::any_of(fr.value()->day_markers.begin(), fr.value()->day_markers.end(),
-                          [x](auto y){ return y==x; });
+  const int k1 = day_of_year_(from, visokos);
+  const int k2 = day_of_year_(to, visokos);
+  if(m.empty() || k1<0 || k2<0) return std::nullopt;
+  const auto days = get_days_with(m.front());
+  for(auto it = std::lower_bound(days.begin(), days.end(), k1); it != days.end() && *it <= k2; ++it) {
+    const int k = *it;
+    const bool b = std::all_of(m.begin(), m.end(), [this, k](auto x){
+      auto markers = day_markers_(k);
+      return std::binary_search(markers.begin(), markers.end(), x);
     });
-    if(b) return ShortDate{month, day};
+    if(b) return date_of_year_(k, visokos);
   }
   return std::nullopt;
 }
 
 std::optional<std::vector<ShortDate>> OrthYear::get_alldates_withanyof(std::span<oxc_const> m) const
-{
-  if(m.empty()) return std::nullopt;
-  std::vector<ShortDate> result;
+{ //объединение отсортированных списков дней (слияние через битовое множество дней года),
+  //результат - по возрастанию, без повторов
+  DaySet x{};
   for(auto i: m) {
-    if(auto x=get_alldates_with(i); x)
-      std::copy(x->begin(), x->end(), std::back_inserter(result));
+    for(auto k : get_days_with(i)) x[k/64] |= uint64_t{1} << (k%64);
+  }
+  return dates_of_(x);
+}
+
+OrthYear::DaySet OrthYear::all_days_() const
+{
+  DaySet res{};
+  const int n = visokos ? 366 : 365;
+  for(int w=0; w<n/64; w++) res[w] = ~uint64_t{};
+  res[n/64] = (uint64_t{1} << (n%64)) - 1;
+  return res;
+}
+
+OrthYear::DaySet OrthYear::days_with_(oxc_const m) const
+{
+  DaySet res{};
+  for(auto k : get_days_with(m)) res[k/64] |= uint64_t{1} << (k%64);
+  return res;
+}
+
+OrthYear::DaySet OrthYear::days_of_weekday_(int8_t wd) const
+{
+  DaySet res{};
+  const int n = visokos ? 366 : 365;
+  for(int k=0; k<n; k++) if(days_hot[k].dn==wd) res[k/64] |= uint64_t{1} << (k%64);
+  return res;
+}
+
+OrthYear::DaySet OrthYear::eval_query_(const PropertyQuery& q) const
+{ //вычисление выражения в обратной польской записи над множествами дней года
+  using Op = PropertyQuery::Op;
+  std::vector<DaySet> stack;
+  stack.reserve(q.items.size());
+  for(const auto& [op, value]: q.items) {
+    switch(op) {
+      case Op::property: { stack.push_back(days_with_(value)); } break;
+      case Op::weekday:  { stack.push_back(days_of_weekday_(static_cast<int8_t>(value))); } break;
+      case Op::not_op: {
+        const auto all = all_days_();
+        auto& x = stack.back();
+        for(std::size_t w=0; w<x.size(); w++) x[w] = ~x[w] & all[w];
+      } break;
+      default: {//and_op, or_op
+        const auto rhs = stack.back();
+        stack.pop_back();
+        auto& lhs = stack.back();
+        for(std::size_t w=0; w<lhs.size(); w++) lhs[w] = op==Op::and_op ? (lhs[w] & rhs[w]) : (lhs[w] | rhs[w]);
+      }
+    };
+  }
+  assert(stack.size()==1);
+  return stack.back();
+}
+
+std::optional<ShortDate> OrthYear::get_date_matching(const PropertyQuery& q, ShortDate from, ShortDate to) const
+{
+  const int k1 = day_of_year_(from, visokos);
+  const int k2 = day_of_year_(to, visokos);
+  if(k1<0 || k2<0 || k1>k2) return std::nullopt;
+  const auto x = eval_query_(q);
+  for(int w = k1/64; w <= k2/64; w++) {
+    auto bits = x[w];
+    if(w == k1/64) bits &= ~uint64_t{} << (k1%64);
+    if(bits) {
+      const int k = w*64 + std::countr_zero(bits);
+      return k <= k2 ? std::optional(date_of_year_(k, visokos)) : std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
+std::size_t OrthYear::count_matching(const PropertyQuery& q, ShortDate from, ShortDate to) const
+{ //кол-во дней в интервале [from; to], удовлетворяющих условию q
+  const int k1 = day_of_year_(from, visokos);
+  const int k2 = day_of_year_(to, visokos);
+  if(k1<0 || k2<0 || k1>k2) return 0;
+  const auto x = eval_query_(q);
+  std::size_t res{};
+  for(int w = k1/64; w <= k2/64; w++) {
+    const int lo = std::max(k1, w*64) - w*64;
+    const int hi = std::min(k2, w*64+63) - w*64;
+    const uint64_t mask = (~uint64_t{} >> (63-(hi-lo))) << lo;
+    res += static_cast<std::size_t>(std::popcount(x[w] & mask));
+  }
+  return res;
+}
+
+std::optional<ShortDate> OrthYear::get_next_matching(const PropertyQuery& q, std::optional<ShortDate> after) const
+{ //первая дата, удовлетворяющая условию q, после даты after (nullopt - с начала года)
+  const int k0 = after ? day_of_year_(*after, visokos) + 1 : 0;
+  if(k0 < 0 || k0 > 365) return std::nullopt;
+  const auto x = eval_query_(q);
+  for(int w = k0/64; w < static_cast<int>(x.size()); w++) {
+    auto bits = x[w];
+    if(w == k0/64) bits &= ~uint64_t{} << (k0%64);
+    if(bits) return date_of_year_(w*64 + std::countr_zero(bits), visokos);
+  }
+  return std::nullopt;
+}
+
+std::optional<ShortDate> OrthYear::get_prev_matching(const PropertyQuery& q, std::optional<ShortDate> before) const
+{ //последняя дата, удовлетворяющая условию q, до даты before (nullopt - с конца года)
+  const int k1 = before ? day_of_year_(*before, visokos) - 1 : 365;
+  if(k1 < 0) return std::nullopt;
+  const auto x = eval_query_(q);
+  for(int w = k1/64; w >= 0; w--) {
+    auto bits = x[w];
+    if(w == k1/64) bits &= ~uint64_t{} >> (63 - k1%64);
+    if(bits) return date_of_year_(w*64 + 63 - std::countl_zero(bits), visokos);
+  }
+  return std::nullopt;
+}
+
+std::optional<std::vector<ShortDate>> OrthYear::get_alldates_matching(const PropertyQuery& q) const
+{
+  return dates_of_(eval_query_(q));
+}
+
+std::optional<std::vector<ShortDate>> OrthYear::dates_of_(const DaySet& x) const
+{ //даты множества x по возрастанию
+  std::vector<ShortDate> res;
+  for(std::size_t w=0; w<x.size(); w++) {
+    for(auto bits = x[w]; bits; bits &= bits-1) {
+      res.push_back(date_of_year_(w*64 + std::countr_zero(bits), visokos));
+    }
+  }
+  if(res.empty()) return std::nullopt;
+  return res;
+}
+
+/*----------------------------------------------*/
+/*             class OrthYearCache              */
+/*----------------------------------------------*/
+
+//потокобезопасный кэш объектов OrthYear. ключи распределены по сегментам,
+//каждый со своим мьютексом; объект для ключа строится только одним потоком,
+//остальные потоки ожидают результат. при превышении ограничений (кол-во
+//объектов, объем памяти) из сегмента вытесняются давно не использованные
+//объекты (LRU), кроме объектов закрепленного диапазона годов.
+class OrthYearCache {
+public:
+  using Value = std::shared_ptr<const OrthYear>;
+  struct Key {
+    big_int year;
+    std::size_t options_fp;            //отпечаток настроек отступки (см. OrthodoxCalendar::impl)
+    std::array<uint8_t,17> indent_opts;
+    bool osen_otstupka_apostol;
+    bool operator==(const Key&) const = default;
+  };
+  struct KeyHash {
+    std::size_t operator()(const Key& k) const noexcept
+    {
+      const auto h = std::hash<long long>{}(k.year.convert_to<long long>());
+      return h ^ (k.options_fp + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+    }
+  };
+private:
+  static constexpr std::size_t SHARDS_COUNT = 16;
+  struct Entry {
+    std::shared_future<Value> future;
+    std::list<Key>::iterator lru_pos;
+    std::size_t bytes{};//0 - объект еще строится
+    bool pinned{};
+  };
+  struct Shard {
+    std::mutex mtx;
+    std::unordered_map<Key, Entry, KeyHash> map;
+    std::list<Key> lru;//в начале - последние использованные ключи
+    std::size_t bytes{};
+  };
+  std::array<Shard, SHARDS_COUNT> shards;
+  std::atomic<std::size_t> max_entries {10000};//0 - без ограничения
+  std::atomic<std::size_t> max_bytes {0};//0 - без ограничения
+  mutable std::mutex pinned_mtx;
+  std::optional<std::pair<big_int, big_int>> pinned_years;
+  std::shared_ptr<CacheMetrics> metrics {std::make_shared<CacheMetrics>()};
+  //упреждающее вычисление годов в фоновом потоке (поток запускается при первой задаче)
+  static constexpr std::size_t READ_AHEAD_QUEUE_SIZE = 64;
+  std::mutex ra_mtx;
+  std::condition_variable ra_cv;
+  std::deque<Key> ra_queue;
+  bool ra_stop{};
+  std::thread ra_thread;
+
+  Shard& shard_for(const Key& key) { return shards[KeyHash{}(key) % SHARDS_COUNT]; }
+  bool is_pinned(const big_int& year) const;
+  void erase(Shard& shard, std::unordered_map<Key, Entry, KeyHash>::iterator it);
+  std::size_t evict(Shard& shard, bool all_unpinned);
+  void read_ahead_loop_();
+public:
+  OrthYearCache() = default;
+  OrthYearCache(const OrthYearCache&) = delete;
+  OrthYearCache& operator=(const OrthYearCache&) = delete;
+  ~OrthYearCache();
+  template<typename Factory>
+    Value get(const Key& key, Factory&& factory);
+  void set_limits(std::size_t entries, std::size_t bytes);
+  void set_pinned_years(std::optional<std::pair<big_int, big_int>> years);
+  void trim();
+  void clear();
+  void set_hook(CacheHook hook) { metrics->set_hook(std::move(hook)); }
+  CacheStats stats();
+  void read_ahead(const Key& key);
+};
+
+bool OrthYearCache::is_pinned(const big_int& year) const
+{ //ключи содержат канонический год (см. canonical_year), поэтому год закреплен,
+  //если в закрепленном интервале есть год с той же раскладкой
+  std::lock_guard lock(pinned_mtx);
+  if(!pinned_years) return false;
+  const auto& [from, to] = *pinned_years;
+  big_int d = (year - from) % JULIAN_CYCLE_YEARS;
+  if(d < 0) d += JULIAN_CYCLE_YEARS;
+  return d <= to - from;
+}
+
+void OrthYearCache::erase(Shard& shard, std::unordered_map<Key, Entry, KeyHash>::iterator it)
+{
+  shard.bytes -= it->second.bytes;
+  shard.lru.erase(it->second.lru_pos);
+  shard.map.erase(it);
+}
+
+std::size_t OrthYearCache::evict(Shard& shard, bool all_unpinned)
+{ //вытеснение с конца списка LRU; строящиеся и закрепленные объекты не вытесняются
+  //возвращает кол-во вытесненных объектов
+  const std::size_t e = max_entries, b = max_bytes;
+  const std::size_t shard_entries = e ? std::max<std::size_t>(1, e / SHARDS_COUNT) : 0;
+  const std::size_t shard_bytes = b / SHARDS_COUNT;
+  auto over = [&](){
+    return all_unpinned || (shard_entries && shard.map.size() > shard_entries)
+                        || (shard_bytes && shard.bytes > shard_bytes);
+  };
+  std::size_t n{};
+  auto it = shard.lru.end();
+  while(it != shard.lru.begin() && over()) {
+    auto x = shard.map.find(*std::prev(it));
+    if(x->second.pinned || x->second.bytes==0) --it;
+    else { erase(shard, x); n++; }
+  }
+  return n;
+}
+
+template<typename Factory>
+  OrthYearCache::Value OrthYearCache::get(const Key& key, Factory&& factory)
+{
+  auto& shard = shard_for(key);
+  std::optional<std::promise<Value>> promise;//создается только при промахе: попадание не выделяет память
+  std::shared_future<Value> future;
+  bool owner{};
+  {
+    std::lock_guard lock(shard.mtx);
+    if(auto x = shard.map.find(key); x != shard.map.end()) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, x->second.lru_pos);
+      future = x->second.future;
+    } else {
+      const bool pinned = is_pinned(key.year);
+      future = promise.emplace().get_future().share();
+      shard.lru.push_front(key);
+      shard.map.emplace(key, Entry{future, shard.lru.begin(), 0, pinned});
+      owner = true;
+    }
+  }
+  //обработчик событий вызывается вне блокировок
+  if(!owner) {
+    metrics->hit();
+  } else {
+    metrics->miss();
+    try {
+      auto value = factory(metrics);
+      promise->set_value(value);
+      std::size_t evicted{};
+      {
+        std::lock_guard lock(shard.mtx);
+        if(auto x = shard.map.find(key); x != shard.map.end() && x->second.bytes==0) {
+          x->second.bytes = value->memory_usage();
+          shard.bytes += x->second.bytes;
+          evicted = evict(shard, false);
+        }
+      }
+      metrics->evicted(evicted);
+    } catch(...) {
+      promise->set_exception(std::current_exception());
+      //неудачная попытка не сохраняется в кэше
+      std::lock_guard lock(shard.mtx);
+      auto x = shard.map.find(key);
+      if(x != shard.map.end() && x->second.bytes==0
+          && x->second.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        erase(shard, x);
+    }
+  }
+  return future.get();
+}
+
+void OrthYearCache::set_limits(std::size_t entries, std::size_t bytes)
+{
+  max_entries = entries;
+  max_bytes = bytes;
+  std::size_t evicted{};
+  for(auto& shard: shards) {
+    std::lock_guard lock(shard.mtx);
+    evicted += evict(shard, false);
+  }
+  metrics->evicted(evicted);
+}
+
+void OrthYearCache::set_pinned_years(std::optional<std::pair<big_int, big_int>> years)
+{
+  {
+    std::lock_guard lock(pinned_mtx);
+    pinned_years = std::move(years);
+  }
+  std::size_t evicted{};
+  for(auto& shard: shards) {
+    std::lock_guard lock(shard.mtx);
+    for(auto& [key, entry]: shard.map) entry.pinned = is_pinned(key.year);
+    evicted += evict(shard, false);
+  }
+  metrics->evicted(evicted);
+}
+
+void OrthYearCache::trim()
+{
+  std::size_t evicted{};
+  for(auto& shard: shards) {
+    std::lock_guard lock(shard.mtx);
+    evicted += evict(shard, true);
+  }
+  metrics->evicted(evicted);
+}
+
+void OrthYearCache::clear()
+{
+  std::size_t removed{};
+  for(auto& shard: shards) {
+    std::lock_guard lock(shard.mtx);
+    removed += shard.map.size();
+    shard.map.clear();
+    shard.lru.clear();
+    shard.bytes = 0;
+  }
+  metrics->cleared(removed);
+}
+
+OrthYearCache::~OrthYearCache()
+{
+  {
+    std::lock_guard lock(ra_mtx);
+    ra_stop = true;
+  }
+  ra_cv.notify_all();
+  if(ra_thread.joinable()) ra_thread.join();
+}
+
+void OrthYearCache::read_ahead(const Key& key)
+{ //поставить год в очередь фонового вычисления, если его нет в кэше
+  {
+    auto& shard = shard_for(key);
+    std::lock_guard lock(shard.mtx);
+    if(shard.map.contains(key)) return;
+  }
+  std::lock_guard lock(ra_mtx);
+  if(ra_stop || ra_queue.size() >= READ_AHEAD_QUEUE_SIZE) return;
+  if(std::find(ra_queue.begin(), ra_queue.end(), key) != ra_queue.end()) return;
+  if(!ra_thread.joinable()) ra_thread = std::thread(&OrthYearCache::read_ahead_loop_, this);
+  ra_queue.push_back(key);
+  ra_cv.notify_one();
+}
+
+void OrthYearCache::read_ahead_loop_()
+{
+  std::unique_lock lock(ra_mtx);
+  while(true) {
+    ra_cv.wait(lock, [this](){ return ra_stop || !ra_queue.empty(); });
+    if(ra_stop) return;
+    const Key key = std::move(ra_queue.front());
+    ra_queue.pop_front();
+    lock.unlock();
+    try {
+      get(key, [&key](std::shared_ptr<CacheMetrics> m){
+        return std::make_shared<const OrthYear>(key.year, key.indent_opts, key.osen_otstupka_apostol, std::move(m));
+      })->build_all();
+    } catch(...) {
+      //ошибка будет получена при синхронном запросе года
+    }
+    lock.lock();
+  }
+}
+
+CacheStats OrthYearCache::stats()
+{
+  CacheStats s;
+  metrics->fill(s);
+  for(auto& shard: shards) {
+    std::lock_guard lock(shard.mtx);
+    s.entries += shard.map.size();
+    s.bytes += shard.bytes;
+  }
+  return s;
+}
+
+/*----------------------------------------------------*/
+/*        class OrthodoxCalendar::YearStore           */
+/*----------------------------------------------------*/
+
+//вычисленные годы не зависят от объекта календаря (настройки входят в ключ),
+//поэтому кэш может разделяться любым кол-вом календарей
+class OrthodoxCalendar::YearStore : public OrthYearCache {};
+
+/*----------------------------------------------------*/
+/*      class OrthodoxCalendar::PropertyQuery         */
+/*----------------------------------------------------*/
+
+PropertyQuery PropertyQuery::property(oxc_const p)
+{
+  return PropertyQuery(Op::property, p);
+}
+
+PropertyQuery PropertyQuery::weekday(const Weekday wd)
+{
+  if(wd<0 || wd>6) throw std::runtime_error("некорректный номер дня недели: "+std::to_string(wd));
+  return PropertyQuery(Op::weekday, static_cast<uint16_t>(wd));
+}
+
+PropertyQuery PropertyQuery::anyof(std::span<oxc_const> properties)
+{
+  if(properties.empty()) throw std::runtime_error("пустой список свойств для PropertyQuery::anyof");
+  PropertyQuery res(Op::property, properties.front());
+  for(auto i: properties.subspan(1)) res = std::move(res) || property(i);
+  return res;
+}
+
+PropertyQuery PropertyQuery::allof(std::span<oxc_const> properties)
+{
+  if(properties.empty()) throw std::runtime_error("пустой список свойств для PropertyQuery::allof");
+  PropertyQuery res(Op::property, properties.front());
+  for(auto i: properties.subspan(1)) res = std::move(res) && property(i);
+  return res;
+}
+
+PropertyQuery operator&&(PropertyQuery lhs, const PropertyQuery& rhs)
+{
+  lhs.items.insert(lhs.items.end(), rhs.items.begin(), rhs.items.end());
+  lhs.items.push_back({PropertyQuery::Op::and_op, 0});
+  return lhs;
+}
+
+PropertyQuery operator||(PropertyQuery lhs, const PropertyQuery& rhs)
+{
+  lhs.items.insert(lhs.items.end(), rhs.items.begin(), rhs.items.end());
+  lhs.items.push_back({PropertyQuery::Op::or_op, 0});
+  return lhs;
+}
+
+PropertyQuery operator!(PropertyQuery q)
+{
+  q.items.push_back({PropertyQuery::Op::not_op, 0});
+  return q;
+}
+
+/*----------------------------------------------*/
+/*              class ThreadPool                */
+/*----------------------------------------------*/
+
+//пул потоков фиксированного размера для параллельного обхода годов (см. OrthodoxCalendar::shared_executor).
+//потоки запускаются при передаче первой задачи; исключения задач игнорируются
+class ThreadPool {
+  const unsigned size;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::function<void()>> queue;
+  std::vector<std::thread> threads;
+  bool stop {};
+
+  void loop_();
+
+public:
+  explicit ThreadPool(unsigned n) : size(n) {}
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+  void submit(std::function<void()> task);
+};
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lock(mtx);
+    stop = true;
+  }
+  cv.notify_all();
+  for(auto& t: threads) t.join();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+  {
+    std::lock_guard lock(mtx);
+    if(threads.empty()) {
+      threads.reserve(size);
+      for(unsigned i=0; i<size; i++) threads.emplace_back(&ThreadPool::loop_, this);
+    }
+    queue.push_back(std::move(task));
+  }
+  cv.notify_one();
+}
+
+void ThreadPool::loop_()
+{
+  while(true) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mtx);
+      cv.wait(lock, [this](){ return stop || !queue.empty(); });
+      if(queue.empty()) return;
+      task = std::move(queue.front());
+      queue.pop_front();
+    }
+    try { task(); }
+    catch(...) {}
   }
-  if(result.empty()) return std::nullopt;
-  else return result;
 }
 
 /*----------------------------------------------------*/
@@ -3995,6 +4917,8 @@ std::optional<std::vector<ShortDate>> OrthYear::get_alldates_withanyof(std::span
 
 class OrthodoxCalendar::impl {
 
+  friend struct DateRange::state;
+
   //настройка номеров добавочных седмиц зимней отступкu литургийных чтений
   std::array<uint8_t,5> zimn_otstupka_n5; //при отступке в 5 седмиц.
   std::array<uint8_t,4> zimn_otstupka_n4; //при отступке в 4 седмиц.
@@ -4004,13 +4928,33 @@ class OrthodoxCalendar::impl {
   //настройка номеров добавочных седмиц осенней отступкu литургийных чтений
   std::array<uint8_t,2> osen_otstupka;
   bool osen_otstupka_apostol; //при вычислении осенней отступкu учитывать ли апостол
-  mutable std::unordered_map<std::string, oxc::OrthYear> orthyear_cache;
-
-  OrthYear& get_orthyear_obj(const std::string& year) const;
+  //все настройки отступки в порядке get_options() и их отпечаток;
+  //обновляются при изменении настроек, чтобы не формировать ключ кэша при каждом запросе
+  std::array<uint8_t,17> indent_opts;
+  std::size_t options_fp;
+  //упреждающее вычисление соседних годов (см. set_read_ahead)
+  unsigned read_ahead_forward;
+  bool read_ahead_backward;
+  //исполнитель и кол-во дополнительных задач для параллельного обхода годов (см. set_parallel_executor)
+  Executor parallel_executor;
+  unsigned parallel_tasks;
+  std::shared_ptr<YearStore> orthyear_cache;
+
+  void update_options_fingerprint();
+  OrthYearCache::Value get_orthyear_obj(const big_int& year) const;
+  OrthYearCache::Value get_orthyear_obj(const std::string& year) const;
   template<typename Container>
     bool set_indent_week_numbers_option(Container& container, std::initializer_list<uint8_t> il);
+  void prefetch_(const Year& from, const Year& to, unsigned tasks, const Executor& executor) const;
+  static std::size_t years_count_(const big_int& a, const big_int& b);
+  std::size_t count_inperiod__(const Date& d1, const Date& d2, const PropertyQuery& query, bool any) const;
+  Date nearest_date__(const Date& from, const PropertyQuery& query, bool forward) const;
+  template<typename F>
+    void parallel_years_(std::size_t count, F f) const;
   template<typename MethodPtr>
     auto get_date_option(const Date& date, MethodPtr mptr) const;
+  template<typename F>
+    void for_each_date_year__(std::span<const Date> dates, bool need_glas, bool need_n50, F f) const;
   template<typename TProperty, typename OrthYearMethod, typename SelfPeriodMethod>
     Date get_date__(const Year& year, TProperty property, const CalendarFormat infmt, OrthYearMethod orthyear_method,
           SelfPeriodMethod period_method) const;
@@ -4026,6 +4970,8 @@ class OrthodoxCalendar::impl {
 public:
 
   impl();
+  explicit impl(std::shared_ptr<YearStore> store);
+  impl(const impl& other);
   bool set_winter_indent_weeks_1(const uint8_t w1);
   bool set_winter_indent_weeks_2(const uint8_t w1, const uint8_t w2);
   bool set_winter_indent_weeks_3(const uint8_t w1, const uint8_t w2, const uint8_t w3);
@@ -4035,6 +4981,16 @@ public:
   bool set_spring_indent_weeks(const uint8_t w1, const uint8_t w2);
   void set_spring_indent_apostol(const bool value);
   std::pair<std::vector<uint8_t>, bool> get_options() const;
+  void set_cache_limits(const std::size_t max_years, const std::size_t max_bytes);
+  void set_cache_pinned_years(const Year& from, const Year& to);
+  void trim_cache();
+  void clear_cache();
+  CacheStats cache_stats() const;
+  void set_cache_hook(CacheHook hook);
+  void prefetch(const Year& from, const Year& to, unsigned threads) const;
+  void prefetch(const Year& from, const Year& to, const Executor& executor) const;
+  void set_read_ahead(const unsigned forward, const bool backward);
+  void set_parallel_executor(Executor executor, unsigned tasks);
   std::pair<Month, Day> julian_pascha(const Year& year) const;
   Date pascha(const Year& year, const CalendarFormat infmt) const;
   int8_t winter_indent(const Year& year) const;
@@ -4046,7 +5002,14 @@ public:
   auto date_apostol(const Date& d) const;
   auto date_evangelie(const Date& d) const;
   auto resurrect_evangelie(const Date& d) const;
+  auto day_info(const Date& d) const;
+  void for_each_day(const Date& d1, const Date& d2, const DayVisitor& visitor, const CalendarFormat fmt) const;
+  YearView year_view(const Year& year) const;
+  std::size_t dates_properties_count(std::span<const Date> dates) const;
+  void fill_day_columns(std::span<const Date> dates, const DayColumns& out) const;
   bool is_date_of(const Date& d, oxc_const property) const;
+  void dates_property_masks(std::span<const Date> dates, std::span<oxc_const> properties,
+        std::span<uint64_t> out) const;
   Date get_date_with(const Year& year, oxc_const property, const CalendarFormat infmt) const;
   Date get_date_inperiod_with(const Date& d1, const Date& d2, oxc_const property) const;
   std::vector<Date> get_alldates_with(const Year& year, oxc_const property, const CalendarFormat infmt) const;
@@ -4059,38 +5022,320 @@ public:
         const CalendarFormat infmt) const;
   std::vector<Date> get_alldates_inperiod_withanyof(const Date& d1, const Date& d2,
         std::span<oxc_const> properties) const;
+  Date get_date_matching(const Year& year, const PropertyQuery& query, const CalendarFormat infmt) const;
+  Date get_date_inperiod_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  std::vector<Date> get_alldates_matching(const Year& year, const PropertyQuery& query,
+        const CalendarFormat infmt) const;
+  std::vector<Date> get_alldates_inperiod_matching(const Date& d1, const Date& d2,
+        const PropertyQuery& query) const;
+  std::size_t count_dates_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  bool any_date_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  DateRange dates_inperiod_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  Date next_date_matching(const Date& from, const PropertyQuery& query) const;
+  Date prev_date_matching(const Date& from, const PropertyQuery& query) const;
+  DateRange dates_inperiod_withanyof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const;
   std::string get_description_for_date(const Date& d, std::string& datefmt) const;
   std::string get_description_for_dates(std::span<const Date> days, std::string& datefmt,
         const std::string& separator) const;
 };
 
-OrthodoxCalendar::impl::impl() :
+/*----------------------------------------------------*/
+/*        class OrthodoxCalendar::DateRange           */
+/*----------------------------------------------------*/
+
+struct OrthodoxCalendar::DateRange::state {
+  const impl calendar;//копия настроек календаря (хранилище годов разделяется)
+  const PropertyQuery query;
+  const ShortDate from;//граница периода в первом году
+  const ShortDate to;//граница периода в последнем году
+  const big_int first_year;
+  big_int year;//следующий год для вычисления
+  const big_int last_year;
+  std::string year_str;//текущий год
+  std::vector<ShortDate> year_dates;//даты текущего года
+  std::size_t pos{};
+  std::size_t end{};//даты текущего года внутри периода: year_dates[pos...end)
+  Date current;
+  bool started{};
+  bool done{};
+
+  state(const impl& c, const PropertyQuery& q, const Date& d1, const Date& d2);
+  void advance();
+};
+
+OrthodoxCalendar::DateRange::state::state(const impl& c, const PropertyQuery& q, const Date& d1, const Date& d2)
+    : calendar(c), query(q), from(d1.month(Julian), d1.day(Julian)), to(d2.month(Julian), d2.day(Julian)),
+      first_year(string_to_year(d1.year(Julian))), year(first_year), last_year(string_to_year(d2.year(Julian)))
+{
+}
+
+void OrthodoxCalendar::DateRange::state::advance()
+{
+  while(!done) {
+    if(pos < end) {
+      const auto [m, d] = year_dates[pos++];
+      current = Date(year_str, m, d, Julian);
+      return;
+    }
+    if(year > last_year) break;
+    const auto orthyear_obj = calendar.get_orthyear_obj(year);
+    if(auto x = orthyear_obj->get_alldates_matching(query); x) year_dates = std::move(*x);
+    else year_dates.clear();
+    //даты года отсортированы, границы периода проверяются только в первом и последнем годах
+    auto begin_it = year == first_year ? std::lower_bound(year_dates.begin(), year_dates.end(), from)
+                                       : year_dates.begin();
+    auto end_it = year == last_year ? std::upper_bound(begin_it, year_dates.end(), to) : year_dates.end();
+    pos = static_cast<std::size_t>(begin_it - year_dates.begin());
+    end = std::max(pos, static_cast<std::size_t>(end_it - year_dates.begin()));
+    year_str = year.str();
+    year++;
+  }
+  done = true;
+}
+
+OrthodoxCalendar::DateRange::DateRange(std::shared_ptr<state> s) : st(std::move(s))
+{
+}
+
+OrthodoxCalendar::DateRange::iterator OrthodoxCalendar::DateRange::begin()
+{
+  if(!st->started) {
+    st->started = true;
+    st->advance();
+  }
+  return iterator(st.get());
+}
+
+const Date& OrthodoxCalendar::DateRange::iterator::operator*() const
+{
+  return st->current;
+}
+
+OrthodoxCalendar::DateRange::iterator& OrthodoxCalendar::DateRange::iterator::operator++()
+{
+  st->advance();
+  return *this;
+}
+
+bool operator==(const OrthodoxCalendar::DateRange::iterator& it, std::default_sentinel_t)
+{
+  return !it.st || it.st->done;
+}
+
+static_assert(std::ranges::input_range<OrthodoxCalendar::DateRange>);
+
+/*----------------------------------------------------*/
+/*        class OrthodoxCalendar::YearView            */
+/*----------------------------------------------------*/
+
+struct OrthodoxCalendar::YearView::data {
+  const OrthYearCache::Value orthyear_obj;//вычисленный год (все фазы), удерживается независимо от хранилища
+  const std::string year_str;
+  const int days_count;
+
+  data(OrthYearCache::Value obj, std::string y)
+      : orthyear_obj(std::move(obj)), year_str(std::move(y)), days_count(orthyear_obj->get_days_count())
+  {
+  }
+  int check(int k) const
+  {
+    if(k<0 || k>=days_count) throw std::out_of_range("некорректный номер дня года: "+std::to_string(k));
+    return k;
+  }
+  DayView day(int k) const
+  {
+    DayView v;
+    const auto [m, d] = orthyear_obj->get_date_of_year(k);
+    v.year = year_str;
+    v.month = m;
+    v.day = d;
+    v.weekday = orthyear_obj->get_day_dn(k);
+    v.glas = orthyear_obj->get_day_glas(k);
+    v.n50 = orthyear_obj->get_day_n50(k);
+    v.properties = orthyear_obj->get_day_markers(k);
+    v.apostol = orthyear_obj->get_day_apostol(k);
+    v.evangelie = orthyear_obj->get_day_evangelie(k);
+    v.resurrect_evangelie = orthyear_obj->get_day_resurrect(k);
+    return v;
+  }
+};
+
+OrthodoxCalendar::YearView::YearView(std::shared_ptr<const data> x) : dt(std::move(x))
+{
+}
+
+const Year& OrthodoxCalendar::YearView::year() const
+{
+  return dt->year_str;
+}
+
+bool OrthodoxCalendar::YearView::is_leap() const
+{
+  return dt->days_count == 366;
+}
+
+int OrthodoxCalendar::YearView::days_count() const
+{
+  return dt->days_count;
+}
+
+int OrthodoxCalendar::YearView::day_of_year(const Month m, const Day d) const
+{
+  return dt->orthyear_obj->get_day_of_year(m, d);
+}
+
+std::pair<Month, Day> OrthodoxCalendar::YearView::date_of_year(int k) const
+{
+  return dt->orthyear_obj->get_date_of_year(dt->check(k));
+}
+
+Weekday OrthodoxCalendar::YearView::weekday(int k) const
+{
+  return dt->orthyear_obj->get_day_dn(dt->check(k));
+}
+
+int8_t OrthodoxCalendar::YearView::glas(int k) const
+{
+  return dt->orthyear_obj->get_day_glas(dt->check(k));
+}
+
+int8_t OrthodoxCalendar::YearView::n50(int k) const
+{
+  return dt->orthyear_obj->get_day_n50(dt->check(k));
+}
+
+std::span<const uint16_t> OrthodoxCalendar::YearView::properties(int k) const
+{
+  return dt->orthyear_obj->get_day_markers(dt->check(k));
+}
+
+ApEvReads OrthodoxCalendar::YearView::apostol(int k) const
+{
+  return dt->orthyear_obj->get_day_apostol(dt->check(k));
+}
+
+ApEvReads OrthodoxCalendar::YearView::evangelie(int k) const
+{
+  return dt->orthyear_obj->get_day_evangelie(dt->check(k));
+}
+
+ApEvReads OrthodoxCalendar::YearView::resurrect_evangelie(int k) const
+{
+  return dt->orthyear_obj->get_day_resurrect(dt->check(k));
+}
+
+DayView OrthodoxCalendar::YearView::day(int k) const
+{
+  return dt->day(dt->check(k));
+}
+
+std::span<const uint16_t> OrthodoxCalendar::YearView::days_with(oxc_const property) const
+{
+  return dt->orthyear_obj->get_days_with(property);
+}
+
+OrthodoxCalendar::YearView::iterator OrthodoxCalendar::YearView::begin() const
+{
+  return iterator(dt.get(), 0);
+}
+
+OrthodoxCalendar::YearView::iterator OrthodoxCalendar::YearView::end() const
+{
+  return iterator(dt.get(), dt->days_count);
+}
+
+DayView OrthodoxCalendar::YearView::iterator::operator*() const
+{
+  return dt->day(k);
+}
+
+static_assert(std::ranges::forward_range<const OrthodoxCalendar::YearView>);
+
+OrthodoxCalendar::impl::impl() : impl(OrthodoxCalendar::shared_year_store())
+{
+}
+
+OrthodoxCalendar::impl::impl(std::shared_ptr<YearStore> store) :
     zimn_otstupka_n5           {30,31,17,32,33},
     zimn_otstupka_n4           {30,31,32,33},
     zimn_otstupka_n3           {31,32,33},
     zimn_otstupka_n2           {32,33},
     zimn_otstupka_n1           {33},
     osen_otstupka              {10,11},
-    osen_otstupka_apostol      {false}
-{
+    osen_otstupka_apostol      {false},
+    read_ahead_forward         {0},
+    read_ahead_backward        {false},
+    parallel_executor          {},
+    parallel_tasks             {0},
+    orthyear_cache             {std::move(store)}
+{
+  if(!orthyear_cache) throw std::runtime_error("не задано хранилище вычисленных годов");
+  update_options_fingerprint();
+}
+
+OrthodoxCalendar::impl::impl(const impl& other) :
+    zimn_otstupka_n5           {other.zimn_otstupka_n5},
+    zimn_otstupka_n4           {other.zimn_otstupka_n4},
+    zimn_otstupka_n3           {other.zimn_otstupka_n3},
+    zimn_otstupka_n2           {other.zimn_otstupka_n2},
+    zimn_otstupka_n1           {other.zimn_otstupka_n1},
+    osen_otstupka              {other.osen_otstupka},
+    osen_otstupka_apostol      {other.osen_otstupka_apostol},
+    indent_opts                {other.indent_opts},
+    options_fp                 {other.options_fp},
+    read_ahead_forward         {other.read_ahead_forward},
+    read_ahead_backward        {other.read_ahead_backward},
+    parallel_executor          {other.parallel_executor},
+    parallel_tasks             {other.parallel_tasks},
+    orthyear_cache             {other.orthyear_cache}
+{ //копия разделяет хранилище вычисленных годов с other
+}
+
+void OrthodoxCalendar::impl::update_options_fingerprint()
+{
+  auto it = indent_opts.begin();
+  it = std::copy(zimn_otstupka_n1.begin(), zimn_otstupka_n1.end(), it);
+  it = std::copy(zimn_otstupka_n2.begin(), zimn_otstupka_n2.end(), it);
+  it = std::copy(zimn_otstupka_n3.begin(), zimn_otstupka_n3.end(), it);
+  it = std::copy(zimn_otstupka_n4.begin(), zimn_otstupka_n4.end(), it);
+  it = std::copy(zimn_otstupka_n5.begin(), zimn_otstupka_n5.end(), it);
+  it = std::copy(osen_otstupka.begin(), osen_otstupka.end(), it);
+  //FNV-1a
+  std::size_t h = 14695981039346656037ULL;
+  for(const auto x: indent_opts) h = (h ^ x) * 1099511628211ULL;
+  options_fp = (h ^ static_cast<std::size_t>(osen_otstupka_apostol)) * 1099511628211ULL;
 }
 
-OrthYear& OrthodoxCalendar::impl::get_orthyear_obj(const std::string& year) const
+OrthYearCache::Value OrthodoxCalendar::impl::get_orthyear_obj(const big_int& year) const
 {
-  auto [indent_opts, apostol_opt] = get_options();
-  std::string indent_opts_str;
-  for(const auto x: indent_opts) indent_opts_str += std::to_string(x);
-  std::string key (year + indent_opts_str + std::to_string(apostol_opt));
-  if(auto x = orthyear_cache.find(key); x != orthyear_cache.end()) {
-    return x->second;
-  } else {
-    if(orthyear_cache.size() == 10000) orthyear_cache.clear();
-    auto [it, inserted] = orthyear_cache.try_emplace(key, year, indent_opts, apostol_opt);
-    if(!inserted)
-      throw std::runtime_error("ошибка создания объекта OrthYear("+year+", "+indent_opts_str+", "
-                                +std::to_string(apostol_opt)+")");
-    return it->second;
+  if( year < oxc::MIN_YEAR_VALUE )
+    throw std::out_of_range("выход числа года '"+year.str()+"' за границу диапазона");
+  //годы с одинаковой раскладкой разделяют один объект OrthYear
+  const OrthYearCache::Key key {canonical_year(year), options_fp, indent_opts, osen_otstupka_apostol};
+  auto result = orthyear_cache->get(key, [&](std::shared_ptr<CacheMetrics> metrics){
+    return std::make_shared<const OrthYear>(key.year, indent_opts, osen_otstupka_apostol, std::move(metrics));
+  });
+  if(read_ahead_forward || read_ahead_backward) {
+    try {
+      auto next = key;
+      for(unsigned i=0; i<read_ahead_forward && i+1<JULIAN_CYCLE_YEARS; i++) {
+        next.year = canonical_year(next.year + 1);
+        orthyear_cache->read_ahead(next);
+      }
+      if(read_ahead_backward) {
+        next.year = canonical_year(key.year - 1);
+        orthyear_cache->read_ahead(next);
+      }
+    } catch(...) {
+      //упреждающее вычисление не должно влиять на результат запроса
+    }
   }
+  return result;
+}
+
+OrthYearCache::Value OrthodoxCalendar::impl::get_orthyear_obj(const std::string& year) const
+{
+  return get_orthyear_obj(string_to_year(year));
 }
 
 template<typename Container>
@@ -4099,16 +5344,91 @@ template<typename Container>
   if( std::any_of(il.begin(), il.end(), [](auto i){ return i<1 || i>33; }) ) return false;
   if( !std::equal(container.cbegin(), container.cend(), il.begin()) ) {
     std::copy(il.begin(), il.end(), container.begin());
+    update_options_fingerprint();
   }
   return true;
 }
 
+std::size_t OrthodoxCalendar::impl::years_count_(const big_int& a, const big_int& b)
+{ //кол-во годов в интервале [a; b]
+  if(b - a >= std::numeric_limits<std::size_t>::max())
+    throw std::runtime_error("слишком большой интервал годов");
+  return static_cast<std::size_t>(b - a) + 1;
+}
+
+template<typename F>
+  void OrthodoxCalendar::impl::parallel_years_(std::size_t count, F f) const
+{ //вызов f(i) для i из [0; count) вызывающим потоком и задачами исполнителя parallel_executor;
+  //задачи забирают блоки годов из общего счетчика, пока они не закончатся. если f(i) возвращает true
+  //(найден искомый год), годы с номерами больше i не обрабатываются, все годы с меньшими номерами обрабатываются.
+  constexpr std::size_t BLOCK = 8;
+  constexpr std::size_t MIN_PARALLEL_COUNT = 4*BLOCK;
+  const auto tasks = std::min<std::size_t>(parallel_tasks, (count + BLOCK - 1) / BLOCK - 1);
+  if(!parallel_executor || !tasks || count < MIN_PARALLEL_COUNT) {
+    for(std::size_t i=0; i<count; i++) if(f(i)) break;
+    return;
+  }
+  //состояние разделяется с задачами исполнителя: задача, запущенная после завершения обхода
+  //вызывающим потоком, ничего не делает, поэтому метод не ждет задачи, еще не взятые исполнителем
+  struct Job {
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::size_t active {};
+    bool closed {};
+    std::function<void()> work;
+  };
+  const auto job = std::make_shared<Job>();
+  std::atomic<std::size_t> next {};
+  std::atomic<std::size_t> stop {count};
+  std::exception_ptr error;
+  auto worker = [&](){
+    try {
+      for(auto c = next.fetch_add(BLOCK); c < stop; c = next.fetch_add(BLOCK)) {
+        for(auto i = c; i < std::min(c + BLOCK, count) && i < stop; i++) {
+          if(f(i)) {
+            for(auto s = stop.load(); i+1 < s && !stop.compare_exchange_weak(s, i+1); );
+            break;
+          }
+        }
+      }
+    } catch(...) {
+      std::lock_guard lock(job->mtx);
+      if(!error) error = std::current_exception();
+      stop = 0;
+    }
+  };
+  job->work = worker;
+  for(std::size_t t=0; t<tasks; t++) {
+    try {
+      parallel_executor([job](){
+        {
+          std::lock_guard lock(job->mtx);
+          if(job->closed) return;
+          job->active++;
+        }
+        job->work();
+        std::lock_guard lock(job->mtx);
+        if(--job->active == 0) job->cv.notify_all();
+      });
+    } catch(...) {
+      break;//не удалось передать задачу - годы обработают вызывающий поток и уже переданные задачи
+    }
+  }
+  worker();
+  {
+    std::unique_lock lock(job->mtx);
+    job->closed = true;
+    job->cv.wait(lock, [&job](){ return job->active == 0; });
+  }
+  if(error) std::rethrow_exception(error);
+}
+
 template<typename MethodPtr>
     auto OrthodoxCalendar::impl::get_date_option(const Date& date, MethodPtr mptr) const
 {
   if(!date) throw std::runtime_error(invalid_date);
-  const auto& orthyear_obj = get_orthyear_obj(date.year(Julian));
-  return (&orthyear_obj->*mptr)(date.month(Julian), date.day(Julian));
+  const auto orthyear_obj = get_orthyear_obj(date.year(Julian));
+  return (orthyear_obj.get()->*mptr)(date.month(Julian), date.day(Julian));
 }
 
 template<typename TProperty, typename OrthYearMethod, typename SelfPeriodMethod>
@@ -4116,8 +5436,8 @@ template<typename TProperty, typename OrthYearMethod, typename SelfPeriodMethod>
         OrthYearMethod orthyear_method, SelfPeriodMethod period_method) const
 {
   if(infmt==Julian) {
-    const auto& orthyear_obj = get_orthyear_obj(year);
-    if(auto x = (&orthyear_obj->*orthyear_method)(property); x) {
+    const auto orthyear_obj = get_orthyear_obj(year);
+    if(auto x = (orthyear_obj.get()->*orthyear_method)(property, ShortDate{1,1}, ShortDate{12,31}); x) {
       return Date (year, x->first, x->second, Julian);
     } else return {};
   } else {
@@ -4131,16 +5451,35 @@ template<typename TProperty, typename OrthYearMethod>
 {
   if(!d1 || !d2) throw std::runtime_error(invalid_date);
   auto [min, max] = std::minmax(d1, d2);
-  auto a = string_to_year(min.year(Julian));
-  auto b = string_to_year(max.year(Julian)) + 1;
-  while(a<b) {
-    std::string y = a.str();
-    const auto& orthyear_obj = get_orthyear_obj(y);
-    if(auto x = (&orthyear_obj->*orthyear_method)(property); x) {
-      Date result(y, x->first, x->second, Julian);
-      if( result >= min && result <= max ) return result;
-    }
-    a++;
+  const auto a = string_to_year(min.year(Julian));
+  const big_int span = string_to_year(max.year(Julian)) - a;
+  //раскладка года повторяется через JULIAN_CYCLE_YEARS лет, поэтому просматривается не более одного
+  //цикла после первого (неполного) года: если дата там не найдена, то ее нет во всем периоде
+  const bool whole = span <= JULIAN_CYCLE_YEARS;
+  const std::size_t count = (whole ? static_cast<std::size_t>(span) : JULIAN_CYCLE_YEARS) + 1;
+  //в каждом году ищется первая дата внутри периода: в первом году - не раньше min, в последнем - не позже max
+  const ShortDate from {min.month(Julian), min.day(Julian)};
+  const ShortDate to {max.month(Julian), max.day(Julian)};
+  //годы просматриваются по порядку блоками растущего размера до первой найденной даты
+  constexpr std::size_t MIN_BLOCK = 8;
+  constexpr std::size_t MAX_BLOCK = 128;
+  std::vector<std::optional<Date>> found;
+  for(std::size_t first=0, block=MIN_BLOCK; first<count; first+=block, block=std::min(2*block, MAX_BLOCK)) {
+    const auto n = std::min(block, count - first);
+    found.assign(n, std::nullopt);
+    parallel_years_(n, [&](std::size_t j){
+      const auto i = first + j;
+      const big_int y = a + i;
+      const auto orthyear_obj = get_orthyear_obj(y);
+      const auto x = (orthyear_obj.get()->*orthyear_method)(property, i==0 ? from : ShortDate{1,1},
+            whole && i==count-1 ? to : ShortDate{12,31});
+      if(x) {
+        found[j] = Date(y.str(), x->first, x->second, Julian);
+        return true;
+      }
+      return false;
+    });
+    for(auto& x: found) if(x) return std::move(*x);
   }
   return {};
 }
@@ -4150,8 +5489,8 @@ template<typename TProperty, typename OrthYearMethod, typename SelfPeriodMethod>
         const CalendarFormat infmt, OrthYearMethod orthyear_method, SelfPeriodMethod period_method) const
 {
   if(infmt==Julian) {
-    const auto& orthyear_obj = get_orthyear_obj(year);
-    if(auto x = (&orthyear_obj->*orthyear_method)(property); x) {
+    const auto orthyear_obj = get_orthyear_obj(year);
+    if(auto x = (orthyear_obj.get()->*orthyear_method)(property); x) {
       std::vector<Date> result;
       result.reserve(x->size()) ;
       std::transform(x->begin(), x->end(), std::back_inserter(result), [&year](const auto& e){
@@ -4169,86 +5508,204 @@ template<typename TProperty, typename OrthYearMethod>
   std::vector<Date> OrthodoxCalendar::impl::get_alldates_inperiod__(const Date& d1, const Date& d2,
         TProperty property, OrthYearMethod orthyear_method) const
 {
-  if(!d1 || !d2) throw std::runtime_error(invalid_date);
-  std::vector<Date> semiresult, result;
-  auto [min, max] = std::minmax(d1, d2);
-  auto a = string_to_year(min.year(Julian));
-  auto b = string_to_year(max.year(Julian)) + 1;
-  while(a<b) {
-    std::string y = a.str();
-    const auto& orthyear_obj = get_orthyear_obj(y);
-    if(auto x = (&orthyear_obj->*orthyear_method)(property); x) {
-      std::transform(x->begin(), x->end(), std::back_inserter(semiresult), [&y](const auto& e){
-          return Date(y, e.first, e.second, Julian);
-      });
-    }
-    a++;
+  if(!d1 || !d2) throw std::runtime_error(invalid_date);
+  std::vector<Date> result;
+  auto [min, max] = std::minmax(d1, d2);
+  const auto a = string_to_year(min.year(Julian));
+  const auto b = string_to_year(max.year(Julian));
+  const ShortDate from {min.month(Julian), min.day(Julian)};
+  const ShortDate to {max.month(Julian), max.day(Julian)};
+  //раскладка года повторяется с периодом JULIAN_CYCLE_YEARS, поэтому поиск выполняется
+  //не более чем для одного цикла, а для остальных годов результат только переносится
+  const auto cycle = b - a < JULIAN_CYCLE_YEARS ? static_cast<std::size_t>(b - a) + 1 : JULIAN_CYCLE_YEARS;
+  std::vector<decltype((std::declval<const OrthYear*>()->*orthyear_method)(property))> per_cycle(cycle);
+  bool any {};
+  parallel_years_(cycle, [&](std::size_t i){
+    const auto orthyear_obj = get_orthyear_obj(a + i);
+    per_cycle[i] = (orthyear_obj.get()->*orthyear_method)(property);
+    return false;
+  });
+  for(const auto& x: per_cycle) if(x && !x->empty()) any = true;
+  if(!any) return result;
+  //даты каждого года отсортированы и без повторов, поэтому результаты по годам дописываются
+  //в порядке годов без сортировки; границы периода проверяются только в первом и последнем годах
+  const auto count = years_count_(a, b);
+  for(std::size_t i=0; i<count; i++) {
+    const auto& x = per_cycle[i % cycle];
+    if(!x) continue;
+    auto begin = i==0 ? std::lower_bound(x->begin(), x->end(), from) : x->begin();
+    auto end = i==count-1 ? std::upper_bound(begin, x->end(), to) : x->end();
+    if(begin >= end) continue;
+    const std::string ys = big_int(a + i).str();
+    std::transform(begin, end, std::back_inserter(result), [&ys](const auto& e){
+        return Date(ys, e.first, e.second, Julian);
+    });
+  }
+  return result;
+}
+
+bool OrthodoxCalendar::impl::set_winter_indent_weeks_1(const uint8_t w1)
+{
+  return set_indent_week_numbers_option(zimn_otstupka_n1, {w1});
+}
+
+bool OrthodoxCalendar::impl::set_winter_indent_weeks_2(const uint8_t w1, const uint8_t w2)
+{
+  return set_indent_week_numbers_option(zimn_otstupka_n2, {w1, w2});
+}
+
+bool OrthodoxCalendar::impl::set_winter_indent_weeks_3(const uint8_t w1, const uint8_t w2, const uint8_t w3)
+{
+  return set_indent_week_numbers_option(zimn_otstupka_n3, {w1, w2, w3});
+}
+
+bool OrthodoxCalendar::impl::set_winter_indent_weeks_4(const uint8_t w1, const uint8_t w2,
+      const uint8_t w3, const uint8_t w4)
+{
+  return set_indent_week_numbers_option(zimn_otstupka_n4, {w1, w2, w3, w4});
+}
+
+bool OrthodoxCalendar::impl::set_winter_indent_weeks_5(const uint8_t w1, const uint8_t w2,
+      const uint8_t w3, const uint8_t w4, const uint8_t w5)
+{
+  return set_indent_week_numbers_option(zimn_otstupka_n5, {w1, w2, w3, w4, w5});
+}
+
+bool OrthodoxCalendar::impl::set_spring_indent_weeks(const uint8_t w1, const uint8_t w2)
+{
+  return set_indent_week_numbers_option(osen_otstupka, {w1, w2});
+}
+
+void OrthodoxCalendar::impl::set_spring_indent_apostol(const bool value)
+{
+  osen_otstupka_apostol = value;
+  update_options_fingerprint();
+}
+
+std::pair<std::vector<uint8_t>, bool> OrthodoxCalendar::impl::get_options() const
+{
+  return {std::vector<uint8_t>(indent_opts.begin(), indent_opts.end()), osen_otstupka_apostol};
+}
+
+void OrthodoxCalendar::impl::set_cache_limits(const std::size_t max_years, const std::size_t max_bytes)
+{
+  orthyear_cache->set_limits(max_years, max_bytes);
+}
+
+void OrthodoxCalendar::impl::set_cache_pinned_years(const Year& from, const Year& to)
+{
+  if(from.empty() && to.empty()) {
+    orthyear_cache->set_pinned_years(std::nullopt);
+    return;
   }
-  if(semiresult.empty()) return {};
-  std::sort(semiresult.begin(), semiresult.end());
-  auto begin = std::lower_bound(semiresult.begin(), semiresult.end(), min);
-  if(begin==semiresult.end()) return {};
-  auto end = std::upper_bound(semiresult.begin(), semiresult.end(), max);
-  result.reserve(semiresult.size());
-  std::copy(begin, end, std::back_inserter(result));
-  result.shrink_to_fit();
-  return result;
+  big_int y1 = string_to_year(from);
+  big_int y2 = string_to_year(to);
+  if(y1 > y2) std::swap(y1, y2);
+  orthyear_cache->set_pinned_years(std::make_pair(std::move(y1), std::move(y2)));
 }
 
-bool OrthodoxCalendar::impl::set_winter_indent_weeks_1(const uint8_t w1)
+void OrthodoxCalendar::impl::trim_cache()
 {
-  return set_indent_week_numbers_option(zimn_otstupka_n1, {w1});
+  orthyear_cache->trim();
 }
 
-bool OrthodoxCalendar::impl::set_winter_indent_weeks_2(const uint8_t w1, const uint8_t w2)
+void OrthodoxCalendar::impl::clear_cache()
 {
-  return set_indent_week_numbers_option(zimn_otstupka_n2, {w1, w2});
+  orthyear_cache->clear();
 }
 
-bool OrthodoxCalendar::impl::set_winter_indent_weeks_3(const uint8_t w1, const uint8_t w2, const uint8_t w3)
+CacheStats OrthodoxCalendar::impl::cache_stats() const
 {
-  return set_indent_week_numbers_option(zimn_otstupka_n3, {w1, w2, w3});
+  return orthyear_cache->stats();
 }
 
-bool OrthodoxCalendar::impl::set_winter_indent_weeks_4(const uint8_t w1, const uint8_t w2,
-      const uint8_t w3, const uint8_t w4)
+void OrthodoxCalendar::impl::set_cache_hook(CacheHook hook)
 {
-  return set_indent_week_numbers_option(zimn_otstupka_n4, {w1, w2, w3, w4});
+  orthyear_cache->set_hook(std::move(hook));
 }
 
-bool OrthodoxCalendar::impl::set_winter_indent_weeks_5(const uint8_t w1, const uint8_t w2,
-      const uint8_t w3, const uint8_t w4, const uint8_t w5)
-{
-  return set_indent_week_numbers_option(zimn_otstupka_n5, {w1, w2, w3, w4, w5});
+void OrthodoxCalendar::impl::prefetch_(const Year& from, const Year& to, unsigned tasks, const Executor& executor) const
+{ //каждая задача берет очередной год из общего счетчика, пока годы не закончатся;
+  //метод возвращает управление после завершения всех переданных исполнителю задач
+  big_int a = string_to_year(from);
+  big_int b = string_to_year(to);
+  if(a > b) std::swap(a, b);
+  const auto count = years_count_(a, b);
+  std::atomic<std::size_t> next {};
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::size_t pending {};
+  std::exception_ptr error;
+  auto worker = [&](){
+    try {
+      for(auto i = next++; i < count; i = next++) get_orthyear_obj(a + i)->build_all();
+    } catch(...) {
+      std::lock_guard lock(mtx);
+      if(!error) error = std::current_exception();
+      next = count;
+    }
+    std::lock_guard lock(mtx);
+    if(--pending == 0) cv.notify_all();
+  };
+  tasks = static_cast<unsigned>(std::clamp<std::size_t>(tasks, 1, count));
+  for(unsigned t=0; t<tasks; t++) {
+    {
+      std::lock_guard lock(mtx);
+      pending++;
+    }
+    try {
+      executor([&worker](){ worker(); });
+    } catch(...) {
+      std::lock_guard lock(mtx);
+      pending--;
+      if(!error) error = std::current_exception();
+      next = count;
+      break;
+    }
+  }
+  std::unique_lock lock(mtx);
+  cv.wait(lock, [&pending](){ return pending == 0; });
+  if(error) std::rethrow_exception(error);
+}
+
+void OrthodoxCalendar::impl::prefetch(const Year& from, const Year& to, unsigned threads) const
+{
+  if(!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::thread> pool;
+  pool.reserve(threads);
+  auto join_all = [&pool](){ for(auto& t: pool) t.join(); };
+  try {
+    prefetch_(from, to, threads, [&pool](std::function<void()> task){ pool.emplace_back(std::move(task)); });
+  } catch(...) {
+    join_all();
+    throw;
+  }
+  join_all();
 }
 
-bool OrthodoxCalendar::impl::set_spring_indent_weeks(const uint8_t w1, const uint8_t w2)
+void OrthodoxCalendar::impl::set_parallel_executor(Executor executor, unsigned tasks)
 {
-  return set_indent_week_numbers_option(osen_otstupka, {w1, w2});
+  if(!tasks) tasks = std::max(2u, std::thread::hardware_concurrency()) - 1;
+  parallel_executor = std::move(executor);
+  parallel_tasks = tasks;
 }
 
-void OrthodoxCalendar::impl::set_spring_indent_apostol(const bool value)
+void OrthodoxCalendar::impl::set_read_ahead(const unsigned forward, const bool backward)
 {
-  osen_otstupka_apostol = value;
+  read_ahead_forward = forward;
+  read_ahead_backward = backward;
 }
 
-std::pair<std::vector<uint8_t>, bool> OrthodoxCalendar::impl::get_options() const
+void OrthodoxCalendar::impl::prefetch(const Year& from, const Year& to, const Executor& executor) const
 {
-  std::vector<uint8_t> first_res(17, 0);
-  auto it = first_res.begin();
-  it = std::copy(zimn_otstupka_n1.begin(), zimn_otstupka_n1.end(), it);
-  it = std::copy(zimn_otstupka_n2.begin(), zimn_otstupka_n2.end(), it);
-  it = std::copy(zimn_otstupka_n3.begin(), zimn_otstupka_n3.end(), it);
-  it = std::copy(zimn_otstupka_n4.begin(), zimn_otstupka_n4.end(), it);
-  it = std::copy(zimn_otstupka_n5.begin(), zimn_otstupka_n5.end(), it);
-  it = std::copy(osen_otstupka.begin(), osen_otstupka.end(), it);
-  return {first_res, osen_otstupka_apostol};
+  if(!executor) throw std::runtime_error("не задан исполнитель задач");
+  prefetch_(from, to, std::max(1u, std::thread::hardware_concurrency()), executor);
 }
 
 std::pair<Month, Day> OrthodoxCalendar::impl::julian_pascha(const Year& year) const
 {
-  const auto& orthyear_obj = get_orthyear_obj(year);
-  return orthyear_obj.get_date_with(oxc::pasha).value();
+  const auto orthyear_obj = get_orthyear_obj(year);
+  return orthyear_obj->get_date_with(oxc::pasha).value();
 }
 
 Date OrthodoxCalendar::impl::pascha(const Year& year, const CalendarFormat infmt) const
@@ -4258,14 +5715,14 @@ Date OrthodoxCalendar::impl::pascha(const Year& year, const CalendarFormat infmt
 
 int8_t OrthodoxCalendar::impl::winter_indent(const Year& year) const
 {
-  const auto& orthyear_obj = get_orthyear_obj(year);
-  return orthyear_obj.get_winter_indent() ;
+  const auto orthyear_obj = get_orthyear_obj(year);
+  return orthyear_obj->get_winter_indent() ;
 }
 
 int8_t OrthodoxCalendar::impl::spring_indent(const Year& year) const
 {
-  const auto& orthyear_obj = get_orthyear_obj(year);
-  return orthyear_obj.get_spring_indent() ;
+  const auto orthyear_obj = get_orthyear_obj(year);
+  return orthyear_obj->get_spring_indent() ;
 }
 
 int8_t OrthodoxCalendar::impl::apostol_post_length(const Year& year) const
@@ -4279,9 +5736,9 @@ int8_t OrthodoxCalendar::impl::apostol_post_length(const Year& year) const
       d += month_length(m, leap);
     }
   };
-  const auto& orthyear_obj = get_orthyear_obj(year);
-  auto d1 = orthyear_obj.get_date_with(oxc::ned1_po50);
-  auto d2 = orthyear_obj.get_date_with(oxc::m6d29);
+  const auto orthyear_obj = get_orthyear_obj(year);
+  auto d1 = orthyear_obj->get_date_with(oxc::ned1_po50);
+  auto d2 = orthyear_obj->get_date_with(oxc::m6d29);
   if(d1 && d2) {
     const bool b = is_leap_year(year, Julian);
     int8_t days_count{};
@@ -4307,8 +5764,8 @@ auto OrthodoxCalendar::impl::date_n50(const Date& d) const
 std::vector<uint16_t> OrthodoxCalendar::impl::date_properties(const Date& date) const
 {
   if(!date) return {};
-  const auto& orthyear_obj = get_orthyear_obj(date.year(Julian));
-  if(auto x = orthyear_obj.get_date_properties(date.month(Julian), date.day(Julian)); x) return x.value();
+  const auto orthyear_obj = get_orthyear_obj(date.year(Julian));
+  if(auto x = orthyear_obj->get_date_properties(date.month(Julian), date.day(Julian)); x) return x.value();
   else return {};
 }
 
@@ -4327,12 +5784,129 @@ auto OrthodoxCalendar::impl::resurrect_evangelie(const Date& d) const
   return get_date_option(d, &OrthYear::get_resurrect_evangelie);
 }
 
-bool OrthodoxCalendar::impl::is_date_of(const Date& d, oxc_const property) const
+auto OrthodoxCalendar::impl::day_info(const Date& d) const
+{
+  return get_date_option(d, &OrthYear::get_day_info);
+}
+
+OrthodoxCalendar::YearView OrthodoxCalendar::impl::year_view(const Year& year) const
+{
+  const auto y = string_to_year(year);
+  auto orthyear_obj = get_orthyear_obj(y);
+  orthyear_obj->build_all();
+  return YearView(std::make_shared<const YearView::data>(std::move(orthyear_obj), y.str()));
+}
+
+template<typename F>
+  void OrthodoxCalendar::impl::for_each_date_year__(std::span<const Date> dates, bool need_glas, bool need_n50,
+      F f) const
+{ //вызывает f(i, год, порядковый номер дня) для каждой даты массива. подряд идущие даты одного года
+  //используют один объект года; при смене года он запрашивается из хранилища заново (попадание в кэш
+  //не выделяет память). вычисляются только те ленивые фазы, которые нужны вызывающему
+  for(const auto& d: dates) if(!d) throw std::runtime_error(invalid_date);
+  big_int last_year;
+  OrthYearCache::Value orthyear_obj;
+  for(std::size_t i=0; i<dates.size(); i++) {
+    auto year = dates[i].pimpl->julian_year();
+    if(!orthyear_obj || year != last_year) {
+      orthyear_obj = get_orthyear_obj(year);
+      if(need_glas) orthyear_obj->build_glas();
+      if(need_n50) orthyear_obj->build_n50();
+      last_year = std::move(year);
+    }
+    f(i, *orthyear_obj, orthyear_obj->get_day_of_year(dates[i].month(Julian), dates[i].day(Julian)));
+  }
+}
+
+std::size_t OrthodoxCalendar::impl::dates_properties_count(std::span<const Date> dates) const
 {
-  if(auto x = date_properties(d); !x.empty()) {
-    return std::any_of( x.begin(), x.end(), [property](auto i){ return i==property; } );
+  std::size_t result {};
+  for_each_date_year__(dates, false, false, [&](std::size_t, const OrthYear& orthyear_obj, int k){
+    result += orthyear_obj.get_day_markers(k).size();
+  });
+  return result;
+}
+
+void OrthodoxCalendar::impl::fill_day_columns(std::span<const Date> dates, const DayColumns& out) const
+{
+  const auto n = dates.size();
+  auto check_size = [n](std::size_t size, std::size_t required){
+    if(size && size != required) throw std::runtime_error("размер буфера не соответствует числу дат");
+  };
+  check_size(out.weekday.size(), n);
+  check_size(out.glas.size(), n);
+  check_size(out.n50.size(), n);
+  check_size(out.properties_offs.size(), n+1);
+  if(!out.properties_offs.empty()) out.properties_offs[0] = 0;
+  std::size_t pos {};
+  for_each_date_year__(dates, !out.glas.empty(), !out.n50.empty(), [&](std::size_t i, const OrthYear& orthyear_obj, int k){
+    if(!out.weekday.empty()) out.weekday[i] = orthyear_obj.get_day_dn(k);
+    if(!out.glas.empty()) out.glas[i] = orthyear_obj.get_day_glas(k);
+    if(!out.n50.empty()) out.n50[i] = orthyear_obj.get_day_n50(k);
+    if(!out.properties_offs.empty()) {
+      const auto markers = orthyear_obj.get_day_markers(k);
+      if(out.properties.size() - pos < markers.size())
+        throw std::runtime_error("размер буфера свойств меньше требуемого (см. dates_properties_count)");
+      std::copy(markers.begin(), markers.end(), out.properties.begin() + pos);
+      pos += markers.size();
+      out.properties_offs[i+1] = pos;
+    }
+  });
+}
+
+void OrthodoxCalendar::impl::for_each_day(const Date& d1, const Date& d2, const DayVisitor& visitor,
+      const CalendarFormat fmt) const
+{ //обход по годам юлианского календаря. дата в формате fmt вычисляется один раз для начала периода,
+  //далее увеличивается на день без пересчета через big_int (кроме смены года)
+  if(!d1 || !d2) throw std::runtime_error(invalid_date);
+  if(!visitor) return;
+  auto [min, max] = std::minmax(d1, d2);
+  const auto a = string_to_year(min.year(Julian));
+  const auto b = string_to_year(max.year(Julian));
+  std::string year_str = min.year(fmt);
+  Month month = min.month(fmt);
+  Day day = min.day(fmt);
+  bool leap = is_leap_year(year_str, fmt);
+  auto visit = [&](DayView& v) {
+    v.year = year_str;
+    v.month = month;
+    v.day = day;
+    visitor(v);
+    if(++day > month_length(month, leap)) {
+      day = 1;
+      if(++month > 12) {
+        month = 1;
+        year_str = (string_to_year(year_str) + 1).str();
+        leap = is_leap_year(year_str, fmt);
+      }
+    }
+  };
+  for(big_int y = a; y <= b; ++y) {
+    const ShortDate from = (y == a) ? ShortDate{min.month(Julian), min.day(Julian)} : ShortDate{1, 1};
+    const ShortDate to = (y == b) ? ShortDate{max.month(Julian), max.day(Julian)} : ShortDate{12, 31};
+    get_orthyear_obj(y)->for_each_day(from, to, visit);
   }
-  return false;
+}
+
+bool OrthodoxCalendar::impl::is_date_of(const Date& d, oxc_const property) const
+{
+  if(!d) return false;
+  const auto orthyear_obj = get_orthyear_obj(d.pimpl->julian_year());
+  return orthyear_obj->get_date_has_property(d.month(Julian), d.day(Julian), property);
+}
+
+void OrthodoxCalendar::impl::dates_property_masks(std::span<const Date> dates, std::span<oxc_const> properties,
+      std::span<uint64_t> out) const
+{
+  if(properties.size() > 64) throw std::runtime_error("число свойств превышает 64");
+  if(out.size() != dates.size()) throw std::runtime_error("размер буфера не соответствует числу дат");
+  for_each_date_year__(dates, false, false, [&](std::size_t i, const OrthYear& orthyear_obj, int k){
+    uint64_t mask {};
+    for(std::size_t j=0; j<properties.size(); j++) {
+      if(orthyear_obj.get_day_has_marker(k, properties[j])) mask |= uint64_t{1} << j;
+    }
+    out[i] = mask;
+  });
 }
 
 Date OrthodoxCalendar::impl::get_date_with(const Year& year, oxc_const property,
@@ -4395,6 +5969,131 @@ std::vector<Date> OrthodoxCalendar::impl::get_alldates_inperiod_withanyof(const
   return get_alldates_inperiod__(d1, d2, properties, &OrthYear::get_alldates_withanyof);
 }
 
+Date OrthodoxCalendar::impl::get_date_matching(const Year& year, const PropertyQuery& query,
+      const CalendarFormat infmt) const
+{
+  return get_date__(year, query, infmt, &OrthYear::get_date_matching, &impl::get_date_inperiod_matching);
+}
+
+Date OrthodoxCalendar::impl::get_date_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return get_date_inperiod__(d1, d2, query, &OrthYear::get_date_matching);
+}
+
+std::vector<Date> OrthodoxCalendar::impl::get_alldates_matching(const Year& year, const PropertyQuery& query,
+      const CalendarFormat infmt) const
+{
+  return get_alldates__(year, query, infmt, &OrthYear::get_alldates_matching,
+                                                        &impl::get_alldates_inperiod_matching);
+}
+
+std::vector<Date> OrthodoxCalendar::impl::get_alldates_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return get_alldates_inperiod__(d1, d2, query, &OrthYear::get_alldates_matching);
+}
+
+std::size_t OrthodoxCalendar::impl::count_inperiod__(const Date& d1, const Date& d2, const PropertyQuery& query,
+      bool any) const
+{ //подсчет дат периода без создания объектов Date: первый и последний годы считаются частично,
+  //для полных годов между ними - по одному подсчету на год цикла JULIAN_CYCLE_YEARS.
+  //при any == true возвращает 1 после первой найденной даты
+  if(!d1 || !d2) throw std::runtime_error(invalid_date);
+  auto [min, max] = std::minmax(d1, d2);
+  const auto a = string_to_year(min.year(Julian));
+  const auto b = string_to_year(max.year(Julian));
+  const ShortDate from {min.month(Julian), min.day(Julian)};
+  const ShortDate to {max.month(Julian), max.day(Julian)};
+  if(a == b) return get_orthyear_obj(a)->count_matching(query, from, to);
+  std::size_t result = get_orthyear_obj(a)->count_matching(query, from);
+  if(any && result) return 1;
+  result += get_orthyear_obj(b)->count_matching(query, {1,1}, to);
+  if(any && result) return 1;
+  const auto full = years_count_(a, b) - 2;//годы a+1 ... b-1
+  const auto cycle = std::min<std::size_t>(full, JULIAN_CYCLE_YEARS);
+  std::vector<std::size_t> per_cycle(cycle);
+  parallel_years_(cycle, [&](std::size_t j){
+    per_cycle[j] = get_orthyear_obj(a + 1 + j)->count_matching(query);
+    return any && per_cycle[j] > 0;
+  });
+  for(std::size_t j=0; j<cycle; j++) {
+    if(any && per_cycle[j]) return 1;
+    //кол-во годов j, j+cycle, j+2*cycle ... меньших full
+    result += per_cycle[j] * ((full - j + cycle - 1) / cycle);
+  }
+  return result;
+}
+
+std::size_t OrthodoxCalendar::impl::count_dates_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return count_inperiod__(d1, d2, query, false);
+}
+
+bool OrthodoxCalendar::impl::any_date_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const
+{
+  return count_inperiod__(d1, d2, query, true) > 0;
+}
+
+Date OrthodoxCalendar::impl::nearest_date__(const Date& from, const PropertyQuery& query, bool forward) const
+{ //поиск ближайшей даты после (до) from. раскладка года повторяется через JULIAN_CYCLE_YEARS лет,
+  //поэтому если дата не найдена за цикл, то ее нет совсем
+  if(!from) throw std::runtime_error(invalid_date);
+  const big_int year = string_to_year(from.year(Julian));
+  const ShortDate d {from.month(Julian), from.day(Julian)};
+  auto make_date = [](const big_int& y, const ShortDate& x){
+    //в начале допустимого диапазона дата может не пройти проверку (год по новому стилю < MIN_YEAR_VALUE);
+    //более ранних допустимых дат тогда тоже нет
+    const auto ys = y.str();
+    return Date::check(ys, x.first, x.second, Julian) ? Date(ys, x.first, x.second, Julian) : Date();
+  };
+  if(forward) {
+    if(auto x = get_orthyear_obj(year)->get_next_matching(query, d); x) return make_date(year, *x);
+    for(int i=1; i<=JULIAN_CYCLE_YEARS; i++) {
+      const big_int y = year + i;
+      if(auto x = get_orthyear_obj(y)->get_next_matching(query, std::nullopt); x) return make_date(y, *x);
+    }
+  } else {
+    if(auto x = get_orthyear_obj(year)->get_prev_matching(query, d); x) return make_date(year, *x);
+    for(int i=1; i<=JULIAN_CYCLE_YEARS && year - i >= oxc::MIN_YEAR_VALUE; i++) {
+      const big_int y = year - i;
+      if(auto x = get_orthyear_obj(y)->get_prev_matching(query, std::nullopt); x) return make_date(y, *x);
+    }
+  }
+  return {};
+}
+
+Date OrthodoxCalendar::impl::next_date_matching(const Date& from, const PropertyQuery& query) const
+{
+  return nearest_date__(from, query, true);
+}
+
+Date OrthodoxCalendar::impl::prev_date_matching(const Date& from, const PropertyQuery& query) const
+{
+  return nearest_date__(from, query, false);
+}
+
+OrthodoxCalendar::DateRange OrthodoxCalendar::impl::dates_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  if(!d1 || !d2) throw std::runtime_error(invalid_date);
+  auto [min, max] = std::minmax(d1, d2);
+  return DateRange(std::make_shared<DateRange::state>(*this, query, min, max));
+}
+
+OrthodoxCalendar::DateRange OrthodoxCalendar::impl::dates_inperiod_withanyof(const Date& d1, const Date& d2,
+      std::span<oxc_const> properties) const
+{
+  if(!properties.empty()) return dates_inperiod_matching(d1, d2, PropertyQuery::anyof(properties));
+  if(!d1 || !d2) throw std::runtime_error(invalid_date);
+  auto [min, max] = std::minmax(d1, d2);
+  auto st = std::make_shared<DateRange::state>(*this, PropertyQuery::property(pasha), min, max);
+  st->started = st->done = true;//пустой список свойств - пустая последовательность
+  return DateRange(std::move(st));
+}
+
+
 std::string OrthodoxCalendar::impl::get_description_for_date(const Date& d, std::string& datefmt) const
 {
   if(!d) return {};
@@ -4434,6 +6133,30 @@ OrthodoxCalendar::OrthodoxCalendar() : pimpl(new OrthodoxCalendar::impl())
 {
 }
 
+OrthodoxCalendar::OrthodoxCalendar(std::shared_ptr<YearStore> store)
+    : pimpl(new OrthodoxCalendar::impl(std::move(store)))
+{
+}
+
+/*static*/std::shared_ptr<OrthodoxCalendar::YearStore> OrthodoxCalendar::make_year_store()
+{
+  return std::make_shared<YearStore>();
+}
+
+/*static*/std::shared_ptr<OrthodoxCalendar::YearStore> OrthodoxCalendar::shared_year_store()
+{
+  static const auto store = make_year_store();
+  return store;
+}
+
+/*static*/Executor OrthodoxCalendar::shared_executor()
+{
+  const unsigned threads = std::thread::hardware_concurrency();
+  if(threads < 2) return {};
+  static ThreadPool pool(threads - 1);
+  return [](std::function<void()> task){ pool.submit(std::move(task)); };
+}
+
 OrthodoxCalendar::~OrthodoxCalendar() = default	;
 
 OrthodoxCalendar::OrthodoxCalendar(OrthodoxCalendar&&) noexcept = default;
@@ -4491,6 +6214,56 @@ std::pair<std::vector<uint8_t>, bool> OrthodoxCalendar::get_options() const
   return pimpl->get_options();
 }
 
+void OrthodoxCalendar::set_cache_limits(const std::size_t max_years, const std::size_t max_bytes)
+{
+  return pimpl->set_cache_limits(max_years, max_bytes);
+}
+
+void OrthodoxCalendar::set_cache_pinned_years(const Year& from, const Year& to)
+{
+  return pimpl->set_cache_pinned_years(from, to);
+}
+
+void OrthodoxCalendar::trim_cache()
+{
+  return pimpl->trim_cache();
+}
+
+void OrthodoxCalendar::clear_cache()
+{
+  return pimpl->clear_cache();
+}
+
+OrthodoxCalendar::CacheStats OrthodoxCalendar::cache_stats() const
+{
+  return pimpl->cache_stats();
+}
+
+void OrthodoxCalendar::set_cache_hook(CacheHook hook)
+{
+  return pimpl->set_cache_hook(std::move(hook));
+}
+
+void OrthodoxCalendar::prefetch(const Year& from, const Year& to, unsigned threads) const
+{
+  return pimpl->prefetch(from, to, threads);
+}
+
+void OrthodoxCalendar::prefetch(const Year& from, const Year& to, const Executor& executor) const
+{
+  return pimpl->prefetch(from, to, executor);
+}
+
+void OrthodoxCalendar::set_read_ahead(const unsigned forward, const bool backward)
+{
+  return pimpl->set_read_ahead(forward, backward);
+}
+
+void OrthodoxCalendar::set_parallel_executor(Executor executor, unsigned tasks)
+{
+  return pimpl->set_parallel_executor(std::move(executor), tasks);
+}
+
 std::pair<Month, Day> OrthodoxCalendar::julian_pascha(const Year& year) const
 {
   return pimpl->julian_pascha(year);
@@ -4578,6 +6351,37 @@ ApEvReads OrthodoxCalendar::resurrect_evangelie(const Date& d) const
   return pimpl->resurrect_evangelie(d);
 }
 
+DayInfo OrthodoxCalendar::day_info(const Year& y, const Month m, const Day d, const CalendarFormat infmt) const
+{
+  return pimpl->day_info(Date(y, m, d, infmt));
+}
+
+DayInfo OrthodoxCalendar::day_info(const Date& d) const
+{
+  return pimpl->day_info(d);
+}
+
+void OrthodoxCalendar::for_each_day(const Date& d1, const Date& d2, const DayVisitor& visitor,
+      const CalendarFormat fmt) const
+{
+  pimpl->for_each_day(d1, d2, visitor, fmt);
+}
+
+OrthodoxCalendar::YearView OrthodoxCalendar::year_view(const Year& year) const
+{
+  return pimpl->year_view(year);
+}
+
+std::size_t OrthodoxCalendar::dates_properties_count(std::span<const Date> dates) const
+{
+  return pimpl->dates_properties_count(dates);
+}
+
+void OrthodoxCalendar::fill_day_columns(std::span<const Date> dates, const DayColumns& out) const
+{
+  pimpl->fill_day_columns(dates, out);
+}
+
 bool OrthodoxCalendar::is_date_of(const Year& y, const Month m, const Day d, oxc_const property,
       const CalendarFormat infmt) const
 {
@@ -4589,6 +6393,12 @@ bool OrthodoxCalendar::is_date_of(const Date& d, oxc_const property) const
   return pimpl->is_date_of(d, property);
 }
 
+void OrthodoxCalendar::dates_property_masks(std::span<const Date> dates, std::span<oxc_const> properties,
+      std::span<uint64_t> out) const
+{
+  pimpl->dates_property_masks(dates, properties, out);
+}
+
 Date OrthodoxCalendar::get_date_with(const Year& year, oxc_const property, const CalendarFormat infmt) const
 {
   return pimpl->get_date_with(year, property, infmt);
@@ -4646,6 +6456,126 @@ std::vector<Date> OrthodoxCalendar::get_alldates_inperiod_withanyof(const Date&
   return pimpl->get_alldates_inperiod_withanyof(d1, d2, properties);
 }
 
+Date OrthodoxCalendar::get_date_matching(const Year& year, const PropertyQuery& query,
+      const CalendarFormat infmt) const
+{
+  return pimpl->get_date_matching(year, query, infmt);
+}
+
+Date OrthodoxCalendar::get_date_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return pimpl->get_date_inperiod_matching(d1, d2, query);
+}
+
+std::vector<Date> OrthodoxCalendar::get_alldates_matching(const Year& year, const PropertyQuery& query,
+      const CalendarFormat infmt) const
+{
+  return pimpl->get_alldates_matching(year, query, infmt);
+}
+
+std::vector<Date> OrthodoxCalendar::get_alldates_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return pimpl->get_alldates_inperiod_matching(d1, d2, query);
+}
+
+std::size_t OrthodoxCalendar::count_dates_with(const Date& d1, const Date& d2, oxc_const property) const
+{
+  return pimpl->count_dates_matching(d1, d2, PropertyQuery::property(property));
+}
+
+std::size_t OrthodoxCalendar::count_dates_withanyof(const Date& d1, const Date& d2,
+      std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return 0;
+  return pimpl->count_dates_matching(d1, d2, PropertyQuery::anyof(properties));
+}
+
+std::size_t OrthodoxCalendar::count_dates_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return pimpl->count_dates_matching(d1, d2, query);
+}
+
+bool OrthodoxCalendar::any_date_with(const Date& d1, const Date& d2, oxc_const property) const
+{
+  return pimpl->any_date_matching(d1, d2, PropertyQuery::property(property));
+}
+
+bool OrthodoxCalendar::any_date_withanyof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return false;
+  return pimpl->any_date_matching(d1, d2, PropertyQuery::anyof(properties));
+}
+
+bool OrthodoxCalendar::any_date_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const
+{
+  return pimpl->any_date_matching(d1, d2, query);
+}
+
+Date OrthodoxCalendar::next_date_with(const Date& from, oxc_const property) const
+{
+  return pimpl->next_date_matching(from, PropertyQuery::property(property));
+}
+
+Date OrthodoxCalendar::next_date_withanyof(const Date& from, std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return {};
+  return pimpl->next_date_matching(from, PropertyQuery::anyof(properties));
+}
+
+Date OrthodoxCalendar::next_date_withallof(const Date& from, std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return {};
+  return pimpl->next_date_matching(from, PropertyQuery::allof(properties));
+}
+
+Date OrthodoxCalendar::next_date_matching(const Date& from, const PropertyQuery& query) const
+{
+  return pimpl->next_date_matching(from, query);
+}
+
+Date OrthodoxCalendar::prev_date_with(const Date& from, oxc_const property) const
+{
+  return pimpl->prev_date_matching(from, PropertyQuery::property(property));
+}
+
+Date OrthodoxCalendar::prev_date_withanyof(const Date& from, std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return {};
+  return pimpl->prev_date_matching(from, PropertyQuery::anyof(properties));
+}
+
+Date OrthodoxCalendar::prev_date_withallof(const Date& from, std::span<oxc_const> properties) const
+{
+  if(properties.empty()) return {};
+  return pimpl->prev_date_matching(from, PropertyQuery::allof(properties));
+}
+
+Date OrthodoxCalendar::prev_date_matching(const Date& from, const PropertyQuery& query) const
+{
+  return pimpl->prev_date_matching(from, query);
+}
+
+OrthodoxCalendar::DateRange OrthodoxCalendar::dates_inperiod_with(const Date& d1, const Date& d2,
+      oxc_const property) const
+{
+  return pimpl->dates_inperiod_matching(d1, d2, PropertyQuery::property(property));
+}
+
+OrthodoxCalendar::DateRange OrthodoxCalendar::dates_inperiod_withanyof(const Date& d1, const Date& d2,
+      std::span<oxc_const> properties) const
+{
+  return pimpl->dates_inperiod_withanyof(d1, d2, properties);
+}
+
+OrthodoxCalendar::DateRange OrthodoxCalendar::dates_inperiod_matching(const Date& d1, const Date& d2,
+      const PropertyQuery& query) const
+{
+  return pimpl->dates_inperiod_matching(d1, d2, query);
+}
+
 std::string OrthodoxCalendar::get_description_for_date(const Year& y, const Month m, const Day d,
       const CalendarFormat infmt, std::string datefmt) const
 {
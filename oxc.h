@@ -27,8 +27,13 @@
 
 #pragma once
 
-#include <cstdint>      // for uint16_t, int8_t, uint8_t
-#include <memory>       // for allocator, unique_ptr
+#include <array>        // for array
+#include <chrono>       // for nanoseconds
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint16_t, int8_t, uint8_t, uint64_t
+#include <functional>   // for function
+#include <iterator>     // for input_iterator_tag, default_sentinel_t
+#include <memory>       // for allocator, unique_ptr, shared_ptr
 #include <optional>     // for optional
 #include <span>         // for span
 #include <string>       // for string, basic_string
@@ -89,6 +94,7 @@ std::string property_title(oxc_const property);
  * или если число (во всех календарных форматах) < MIN_YEAR_VALUE.
  */
 class Date {
+  friend class OrthodoxCalendar;
   class impl;
   std::unique_ptr<impl> pimpl;
 public:
@@ -271,6 +277,8 @@ public:
  * константами типа oxc_const (полный список см. в разделе группы). Также предусмотрена
  * возможность настроить номера седмиц для расчета отступок / преступок рядовых литургийных
  * чтений (по умолчанию вычисления производится в соответствии с оф. календарем МП РПЦ).
+ * Константные методы можно вызывать одновременно из нескольких потоков; методы настройки
+ * (set_*) не должны выполняться параллельно с другими методами того же объекта.
  */
 class OrthodoxCalendar {
   class impl;
@@ -291,8 +299,8 @@ public:
      */
     std::string_view c;
   public:
-    ApostolEvangelieReadings() : n{}, c{} {}
-    ApostolEvangelieReadings(uint16_t a, std::string_view b) : n(a), c(b) {}
+    constexpr ApostolEvangelieReadings() : n{}, c{} {}
+    constexpr ApostolEvangelieReadings(uint16_t a, std::string_view b) : n(a), c(b) {}
     /**
      * метод возвращает идентификатор богослужебной книги :
      * `1=апостол`, `2=от матфея`, `3=от марка`, `4=от луки`, `5=от иоанна`
@@ -309,7 +317,311 @@ public:
     bool operator==(const ApostolEvangelieReadings&) const = default;
     explicit operator bool() const { return n>0; }
   };
+  /**
+   * сводные данные дня, возвращаемые методом day_info (все поля вычисляются за одно обращение к году)
+   */
+  struct DayInfo {
+    static constexpr std::size_t MAX_PROPERTIES = 32;///< наибольшее число свойств одной даты
+    int8_t glas {-1};                             ///< глас ( см. date_glas )
+    int8_t n50 {-1};                              ///< номер недели / седмицы ( см. date_n50 )
+    ApostolEvangelieReadings apostol;             ///< рядовое чтение Апостола ( см. date_apostol )
+    ApostolEvangelieReadings evangelie;           ///< рядовое чтение Евангелия ( см. date_evangelie )
+    ApostolEvangelieReadings resurrect_evangelie; ///< воскресное Евангелие утрени ( см. resurrect_evangelie )
+    uint8_t properties_count {};                  ///< число свойств даты
+    std::array<uint16_t, MAX_PROPERTIES> properties_data {};///< свойства даты ( первые properties_count элементов )
+    /**
+     * метод возвращает свойства даты - константы из пространства oxc:: ( см. date_properties )
+     */
+    std::span<const uint16_t> properties() const { return {properties_data.data(), properties_count}; }
+  };
+  /**
+   * данные дня, передаваемые обработчику метода for_each_day. Поля-ссылки (year, properties)
+   * действительны только во время вызова обработчика.
+   */
+  struct DayView {
+    std::string_view year;                        ///< число года в формате, заданном в for_each_day
+    Month month {};                               ///< число месяца в формате, заданном в for_each_day
+    Day day {};                                   ///< число дня в формате, заданном в for_each_day
+    Weekday weekday {};                           ///< день недели (0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб)
+    int8_t glas {-1};                             ///< глас ( см. date_glas )
+    int8_t n50 {-1};                              ///< номер недели / седмицы ( см. date_n50 )
+    std::span<const uint16_t> properties;         ///< свойства даты ( см. date_properties )
+    ApostolEvangelieReadings apostol;             ///< рядовое чтение Апостола ( см. date_apostol )
+    ApostolEvangelieReadings evangelie;           ///< рядовое чтение Евангелия ( см. date_evangelie )
+    ApostolEvangelieReadings resurrect_evangelie; ///< воскресное Евангелие утрени ( см. resurrect_evangelie )
+  };
+  using DayVisitor = std::function<void(const DayView&)>;
+  /**
+   * буферы-столбцы для пакетного метода fill_day_columns. Каждый непустой span должен иметь размер,
+   * равный числу дат (для properties_offs - на единицу больше); пустые столбцы не заполняются.
+   * Размер properties должен быть не меньше значения dates_properties_count для того же массива дат.
+   */
+  struct DayColumns {
+    std::span<Weekday> weekday;                ///< дни недели (0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб)
+    std::span<int8_t> glas;                    ///< гласы ( см. date_glas )
+    std::span<int8_t> n50;                     ///< номера недель / седмиц ( см. date_n50 )
+    /**
+     * смещения свойств дат в массиве properties: свойства i-й даты - элементы
+     * properties[properties_offs[i] ... properties_offs[i+1])
+     */
+    std::span<std::size_t> properties_offs;
+    std::span<uint16_t> properties;            ///< массив свойств дат (заполняется вместе с properties_offs)
+  };
+  /**
+   * класс логического выражения над свойствами дат для методов get_date_matching / get_alldates_matching.
+   * выражение составляется из простых условий (методы property, weekday, anyof, allof)
+   * и операторов `&&`, `||`, `!`. Например, условие "суббота любого поста, кроме двунадесятых праздников":<br>
+   * `weekday(6) && anyof(posts) && !anyof(dvana10)`, где posts и dvana10 - массивы соответствующих констант
+   */
+  class PropertyQuery {
+    friend class OrthYear;
+    enum class Op : uint8_t { property, weekday, and_op, or_op, not_op };
+    struct Item {
+      Op op;
+      uint16_t value;
+    };
+    std::vector<Item> items;//выражение в обратной польской записи
+    PropertyQuery(Op op, uint16_t value) : items{ {op, value} } {}
+  public:
+    /**
+     * условие: дата имеет свойство p
+     *
+     * \param [in] p любая константа из пространства oxc:: (полный список см. в разделе группы)
+     */
+    static PropertyQuery property(oxc_const p);
+    /**
+     * условие: дата приходится на день недели wd (0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб)
+     *
+     * \param [in] wd номер дня недели
+     */
+    static PropertyQuery weekday(const Weekday wd);
+    /**
+     * условие: дата имеет любое из свойств properties (массив не должен быть пустым)
+     *
+     * \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+     */
+    static PropertyQuery anyof(std::span<oxc_const> properties);
+    /**
+     * условие: дата имеет все свойства properties (массив не должен быть пустым)
+     *
+     * \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+     */
+    static PropertyQuery allof(std::span<oxc_const> properties);
+    friend PropertyQuery operator&&(PropertyQuery lhs, const PropertyQuery& rhs);
+    friend PropertyQuery operator||(PropertyQuery lhs, const PropertyQuery& rhs);
+    friend PropertyQuery operator!(PropertyQuery q);
+  };
+  /**
+   * ленивая последовательность дат (однопроходный input range), возвращаемая методами dates_inperiod_*.
+   * Даты вычисляются по мере обхода в хронологическом порядке, по одному году за раз, поэтому
+   * обход можно прервать в любой момент. Последовательность не зависит от времени жизни календаря,
+   * создавшего ее (использует копию его настроек и хранилища годов).
+   */
+  class DateRange {
+    friend class OrthodoxCalendar;
+    struct state;
+    std::shared_ptr<state> st;
+    explicit DateRange(std::shared_ptr<state> s);
+  public:
+    class iterator {
+      friend class DateRange;
+      state* st{};
+      explicit iterator(state* s) : st(s) {}
+    public:
+      using iterator_concept = std::input_iterator_tag;
+      using value_type = Date;
+      using difference_type = std::ptrdiff_t;
+      iterator() = default;
+      const Date& operator*() const;
+      iterator& operator++();
+      void operator++(int) { ++*this; }
+      friend bool operator==(const iterator& it, std::default_sentinel_t);
+    };
+    /**
+     * итератор на текущую дату последовательности (при первом вызове вычисляется первая дата).
+     * Последовательность однопроходная: повторный вызов продолжает обход с текущей позиции.
+     */
+    iterator begin();
+    std::default_sentinel_t end() const { return {}; }
+  };
+  /**
+   * неизменяемое представление вычисленного года (см. year_view). Методы обращаются к данным года
+   * напрямую, без поиска в хранилище; представление и его копии остаются действительными независимо
+   * от вытеснения года из хранилища. Дни адресуются порядковым номером k по юлианскому календарю
+   * (0 - 1 января, days_count()-1 - 31 декабря); при k вне диапазона методы генерируют std::out_of_range.
+   * Поля-ссылки данных дня (DayView::year, DayView::properties) действительны, пока существует представление.
+   */
+  class YearView {
+    friend class OrthodoxCalendar;
+    struct data;
+    std::shared_ptr<const data> dt;
+    explicit YearView(std::shared_ptr<const data> x);
+  public:
+    class iterator {
+      friend class YearView;
+      const data* dt{};
+      int k{};
+      iterator(const data* x, int i) : dt(x), k(i) {}
+    public:
+      using iterator_concept = std::forward_iterator_tag;
+      using value_type = DayView;
+      using difference_type = std::ptrdiff_t;
+      iterator() = default;
+      DayView operator*() const;
+      iterator& operator++() { k++; return *this; }
+      iterator operator++(int) { auto t = *this; k++; return t; }
+      bool operator==(const iterator& other) const { return k == other.k; }
+    };
+    /**
+     * метод возвращает число года юлианского календаря
+     */
+    const Year& year() const;
+    /**
+     * метод возвращает true для високосного года
+     */
+    bool is_leap() const;
+    /**
+     * метод возвращает число дней в году (365 или 366)
+     */
+    int days_count() const;
+    /**
+     * метод возвращает порядковый номер дня с датой m, d по юлианскому календарю или -1 для некорректной даты
+     */
+    int day_of_year(const Month m, const Day d) const;
+    /**
+     * метод возвращает дату (месяц, день) по юлианскому календарю для порядкового номера дня k
+     */
+    std::pair<Month, Day> date_of_year(int k) const;
+    /**
+     * метод возвращает день недели (0-вс, 1-пн, 2-вт, 3-ср, 4-чт, 5-пт, 6-сб) дня k
+     */
+    Weekday weekday(int k) const;
+    /**
+     * метод возвращает глас дня k ( см. date_glas )
+     */
+    int8_t glas(int k) const;
+    /**
+     * метод возвращает номер недели / седмицы дня k ( см. date_n50 )
+     */
+    int8_t n50(int k) const;
+    /**
+     * метод возвращает свойства дня k ( см. date_properties )
+     */
+    std::span<const uint16_t> properties(int k) const;
+    /**
+     * метод возвращает рядовое чтение Апостола дня k ( см. date_apostol )
+     */
+    ApostolEvangelieReadings apostol(int k) const;
+    /**
+     * метод возвращает рядовое чтение Евангелия дня k ( см. date_evangelie )
+     */
+    ApostolEvangelieReadings evangelie(int k) const;
+    /**
+     * метод возвращает воскресное Евангелие утрени дня k ( см. resurrect_evangelie )
+     */
+    ApostolEvangelieReadings resurrect_evangelie(int k) const;
+    /**
+     * метод возвращает все данные дня k (поля даты - по юлианскому календарю)
+     */
+    DayView day(int k) const;
+    /**
+     * метод возвращает порядковые номера дней года (по возрастанию), имеющих свойство property
+     */
+    std::span<const uint16_t> days_with(oxc_const property) const;
+    /**
+     * итераторы по всем дням года (по возрастанию)
+     */
+    iterator begin() const;
+    iterator end() const;
+  };
+  /**
+   * хранилище вычисленных (неизменяемых) годов. Годы хранятся вместе с настройками отступки,
+   * поэтому одно хранилище могут разделять календари с любыми настройками. Копии календаря
+   * разделяют хранилище оригинала, а по умолчанию все календари используют общее хранилище
+   * процесса (см. shared_year_store()). Ограничения, закрепленные годы, статистика и обработчик
+   * событий принадлежат хранилищу, а не календарю: методы set_cache_limits, set_cache_pinned_years,
+   * trim_cache, clear_cache и set_cache_hook действуют на все календари с тем же хранилищем
+   * (для календаря, созданного конструктором по умолчанию, - на весь процесс). Независимые
+   * настройки требуют отдельного хранилища (см. make_year_store()).
+   */
+  class YearStore;
+  /**
+   *  Метод создает новое пустое хранилище вычисленных годов.
+   */
+  static std::shared_ptr<YearStore> make_year_store();
+  /**
+   *  Метод возвращает общее хранилище вычисленных годов процесса, используемое по умолчанию.
+   */
+  static std::shared_ptr<YearStore> shared_year_store();
+  /**
+   * фазы вычисления года (кроме markers, фазы вычисляются лениво при первом обращении)
+   */
+  enum class BuildPhase : uint8_t {
+    markers,  ///< дни недели и свойства дней (при создании года)
+    glas,     ///< гласы октоиха
+    n50,      ///< седмицы по пятидесятнице и отступки чтений
+    readings  ///< апостольские / евангельские чтения
+  };
+  /**
+   * события хранилища вычисленных годов
+   */
+  enum class CacheEvent : uint8_t {
+    hit,      ///< год найден в хранилище
+    miss,     ///< год отсутствует в хранилище и будет вычислен
+    eviction, ///< годы удалены из хранилища при превышении ограничений или вызове trim_cache()
+    clear,    ///< хранилище очищено методом clear_cache()
+    build     ///< выполнена фаза вычисления года
+  };
+  /**
+   * описание события для функции-обработчика (см. set_cache_hook())
+   */
+  struct CacheEventInfo {
+    CacheEvent event;
+    std::size_t count;                 ///< кол-во удаленных годов (для eviction и clear), иначе 1
+    BuildPhase phase;                  ///< фаза (только для build)
+    std::chrono::nanoseconds duration; ///< время выполнения фазы (только для build)
+  };
+  using CacheHook = std::function<void(const CacheEventInfo&)>;
+  /**
+   * исполнитель задач (например, пул потоков приложения): функция должна запустить
+   * переданную задачу (немедленно или позднее, в любом потоке).
+   */
+  using Executor = std::function<void(std::function<void()>)>;
+  /**
+   *  Метод возвращает исполнителя задач на основе общего пула потоков процесса
+   *  (кол-во ядер процессора - 1 потоков) для параллельного обхода годов (см. set_parallel_executor).
+   *  Пул создается при первом вызове метода. На одноядерной системе возвращает пустое значение.
+   */
+  static Executor shared_executor();
+  /**
+   * статистика хранилища вычисленных годов (см. cache_stats()). Счетчики накапливаются
+   * с момента создания хранилища.
+   */
+  struct CacheStats {
+    static constexpr std::size_t PHASES_COUNT = 4;
+    /**
+     * кол-во корзин гистограммы: корзина 0 - время менее 1 мкс, корзина i - время
+     * в интервале [2^(i-1); 2^i) мкс, последняя корзина - все что больше.
+     */
+    static constexpr std::size_t HIST_SIZE = 20;
+    std::uint64_t hits{};
+    std::uint64_t misses{};
+    std::uint64_t evictions{};    ///< кол-во вытесненных годов
+    std::uint64_t clears{};       ///< кол-во вызовов clear_cache()
+    std::size_t entries{};        ///< текущее кол-во годов в хранилище
+    std::size_t bytes{};          ///< текущий объем памяти, занимаемой годами (приблизительно)
+    std::array<std::uint64_t, PHASES_COUNT> builds{};        ///< кол-во выполнений фазы (индекс - BuildPhase)
+    std::array<std::uint64_t, PHASES_COUNT> build_time_ns{}; ///< суммарное время выполнения фазы
+    std::array<std::array<std::uint64_t, HIST_SIZE>, PHASES_COUNT> build_time_hist{};
+  };
   OrthodoxCalendar();
+  /**
+   *  Конструктор календаря с отдельным хранилищем вычисленных годов.
+   *
+   *  \param [in] store хранилище, созданное методом make_year_store().
+   *  \throw std::runtime_error если store пустой указатель.
+   */
+  explicit OrthodoxCalendar(std::shared_ptr<YearStore> store);
   OrthodoxCalendar(const OrthodoxCalendar&);
   OrthodoxCalendar& operator=(const OrthodoxCalendar&);
   OrthodoxCalendar(OrthodoxCalendar&&) noexcept;
@@ -438,6 +750,57 @@ public:
    *  Перегруженная версия. Отличается только типом параметров.
    */
   ApostolEvangelieReadings resurrect_evangelie(const Date& d) const;
+  /**
+   *  Метод вычисляет для указанной даты сразу все данные дня: глас, номер седмицы, свойства и чтения.
+   *  Результат совпадает с результатами методов date_glas, date_n50, date_properties, date_apostol,
+   *  date_evangelie и resurrect_evangelie, но требует одного поиска года в кэше. Свойства копируются
+   *  во встроенный массив DayInfo, поэтому под результат память не выделяется; сам вызов может выделять
+   *  память (построение года при промахе кэша, временный объект Date в перегрузке с числом года)
+   *
+   *  \param [in] y число года
+   *  \param [in] m число месяца
+   *  \param [in] d число дня
+   *  \param [in] infmt тип календаря для даты
+   */
+  DayInfo day_info(const Year& y, const Month m, const Day d, const CalendarFormat infmt=Julian) const;
+  /**
+   *  Перегруженная версия. Отличается только типом параметров.
+   */
+  DayInfo day_info(const Date& d) const;
+  /**
+   *  Метод последовательно передает обработчику visitor данные каждого дня периода (по возрастанию дат).
+   *  Данные берутся непосредственно из вычисленных годов, без создания объектов Date для каждого дня,
+   *  поэтому метод подходит для выгрузки длинных периодов
+   *
+   *  \param [in] d1 начальная дата периода (включительно)
+   *  \param [in] d2 конечная дата периода (включительно)
+   *  \param [in] visitor обработчик данных дня
+   *  \param [in] fmt тип календаря для полей year, month, day передаваемых данных
+   */
+  void for_each_day(const Date& d1, const Date& d2, const DayVisitor& visitor, const CalendarFormat fmt=Julian) const;
+  /**
+   *  Метод возвращает представление указанного года (см. описание класса YearView). Все данные года
+   *  вычисляются сразу, поэтому последующие обращения к представлению не требуют поиска в хранилище
+   *
+   *  \param [in] year число года юлианского календаря
+   */
+  YearView year_view(const Year& year) const;
+  /**
+   *  Метод возвращает суммарное число свойств дат массива - необходимый размер буфера
+   *  DayColumns::properties для метода fill_day_columns
+   *
+   *  \param [in] dates массив дат
+   */
+  std::size_t dates_properties_count(std::span<const Date> dates) const;
+  /**
+   *  Пакетный метод: вычисляет данные для массива дат и записывает их в столбцы out.
+   *  Подряд идущие даты одного года используют один запрос к хранилищу, поэтому для упорядоченного
+   *  массива каждый год запрашивается один раз (порядок дат произвольный, результаты записываются в порядке дат)
+   *
+   *  \param [in] dates массив дат
+   *  \param [out] out буферы для результатов ( см. описание структуры DayColumns )
+   */
+  void fill_day_columns(std::span<const Date> dates, const DayColumns& out) const;
   /**
    *  Метод проверяет соответствует ли указанная дата признаку property
    *
@@ -453,6 +816,17 @@ public:
    *  Перегруженная версия. Отличается только типом параметров.
    */
   bool is_date_of(const Date& d, oxc_const property) const;
+  /**
+   *  Пакетный метод: для каждой даты массива dates записывает в out битовую маску свойств:
+   *  бит j установлен, если дата имеет свойство properties[j]. Подряд идущие даты одного года
+   *  используют один запрос к хранилищу
+   *
+   *  \param [in] dates массив дат
+   *  \param [in] properties массив констант из пространства oxc:: (не более 64)
+   *  \param [out] out маски свойств (размер должен быть равен числу дат)
+   */
+  void dates_property_masks(std::span<const Date> dates, std::span<oxc_const> properties,
+        std::span<uint64_t> out) const;
   /**
    *  Метод возвращает первую найденную дату в указанном году, соответствующую параметру property
    *
@@ -470,7 +844,7 @@ public:
    */
   Date get_date_inperiod_with(const Date& d1, const Date& d2, oxc_const property) const;
   /**
-   *  Метод возвращает все даты в указанном году, соответствующие параметру property; или пустой вектор
+   *  Метод возвращает все даты в указанном году (по возрастанию), соответствующие параметру property; или пустой вектор
    *       если ни одна дата не найдена
    *
    *  \param [in] year число года
@@ -479,7 +853,7 @@ public:
    */
   std::vector<Date> get_alldates_with(const Year& year, oxc_const property, const CalendarFormat infmt=Julian) const;
   /**
-   *  Метод возвращает все даты за указанный период, соответствующие параметру property; или пустой вектор
+   *  Метод возвращает все даты за указанный период (по возрастанию), соответствующие параметру property; или пустой вектор
    *       если ни одна дата не найдена
    *
    *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
@@ -521,7 +895,8 @@ public:
    */
   Date get_date_inperiod_withallof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const;
   /**
-   *  Метод возвращает все даты в указанном году, соответствующие любому из элементов параметра properties
+   *  Метод возвращает все даты в указанном году (по возрастанию, без повторов), соответствующие любому
+   *  из элементов параметра properties
    *
    *  \param [in] year число года
    *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
@@ -530,7 +905,8 @@ public:
   std::vector<Date> get_alldates_withanyof(const Year& year, std::span<oxc_const> properties,
         const CalendarFormat infmt=Julian) const;
   /**
-   *  Метод возвращает все даты за указанный период, соответствующие любому из элементов параметра properties
+   *  Метод возвращает все даты за указанный период (по возрастанию, без повторов), соответствующие любому
+   *  из элементов параметра properties
    *
    *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
    *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
@@ -538,6 +914,172 @@ public:
    */
   std::vector<Date> get_alldates_inperiod_withanyof(const Date& d1, const Date& d2,
         std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает первую найденную дату в указанном году, удовлетворяющую условию query
+   *
+   *  \param [in] year число года
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   *  \param [in] infmt тип календаря для числа года
+   */
+  Date get_date_matching(const Year& year, const PropertyQuery& query, const CalendarFormat infmt=Julian) const;
+  /**
+   *  Метод возвращает первую найденную дату за указанный период, удовлетворяющую условию query
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  Date get_date_inperiod_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  /**
+   *  Метод возвращает все даты в указанном году (по возрастанию, без повторов), удовлетворяющие
+   *  условию query; или пустой вектор если ни одна дата не найдена
+   *
+   *  \param [in] year число года
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   *  \param [in] infmt тип календаря для числа года
+   */
+  std::vector<Date> get_alldates_matching(const Year& year, const PropertyQuery& query,
+        const CalendarFormat infmt=Julian) const;
+  /**
+   *  Метод возвращает все даты за указанный период (по возрастанию, без повторов), удовлетворяющие
+   *  условию query; или пустой вектор если ни одна дата не найдена
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  std::vector<Date> get_alldates_inperiod_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  /**
+   *  Метод возвращает кол-во дат за указанный период, имеющих свойство property (объекты Date не создаются)
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] property одна из констант пространства oxc:: (полный список см. в разделе группы)
+   */
+  std::size_t count_dates_with(const Date& d1, const Date& d2, oxc_const property) const;
+  /**
+   *  Метод возвращает кол-во дат (без повторов) за указанный период, имеющих любое из свойств properties
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  std::size_t count_dates_withanyof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает кол-во дат за указанный период, удовлетворяющих условию query
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  std::size_t count_dates_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  /**
+   *  Метод проверяет, есть ли за указанный период хотя бы одна дата со свойством property
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] property одна из констант пространства oxc:: (полный список см. в разделе группы)
+   */
+  bool any_date_with(const Date& d1, const Date& d2, oxc_const property) const;
+  /**
+   *  Метод проверяет, есть ли за указанный период хотя бы одна дата с любым из свойств properties
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  bool any_date_withanyof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const;
+  /**
+   *  Метод проверяет, есть ли за указанный период хотя бы одна дата, удовлетворяющая условию query
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  bool any_date_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
+  /**
+   *  Метод возвращает ближайшую после даты from дату, имеющую свойство property; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] property одна из констант пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date next_date_with(const Date& from, oxc_const property) const;
+  /**
+   *  Метод возвращает ближайшую после даты from дату, имеющую любое из свойств properties; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date next_date_withanyof(const Date& from, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает ближайшую после даты from дату, имеющую все свойства properties; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date next_date_withallof(const Date& from, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает ближайшую после даты from дату, удовлетворяющую условию query; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  Date next_date_matching(const Date& from, const PropertyQuery& query) const;
+  /**
+   *  Метод возвращает ближайшую до даты from дату, имеющую свойство property; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] property одна из констант пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date prev_date_with(const Date& from, oxc_const property) const;
+  /**
+   *  Метод возвращает ближайшую до даты from дату, имеющую любое из свойств properties; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date prev_date_withanyof(const Date& from, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает ближайшую до даты from дату, имеющую все свойства properties; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  Date prev_date_withallof(const Date& from, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает ближайшую до даты from дату, удовлетворяющую условию query; или пустую дату, если такой даты нет
+   *
+   *  \param [in] from дата, от которой выполняется поиск (сама дата не учитывается)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  Date prev_date_matching(const Date& from, const PropertyQuery& query) const;
+  /**
+   *  Метод возвращает ленивую последовательность дат за указанный период (по возрастанию),
+   *  имеющих свойство property
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] property одна из констант пространства oxc:: (полный список см. в разделе группы)
+   */
+  DateRange dates_inperiod_with(const Date& d1, const Date& d2, oxc_const property) const;
+  /**
+   *  Метод возвращает ленивую последовательность дат за указанный период (по возрастанию, без повторов),
+   *  имеющих любое из свойств properties
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] properties массив констант из пространства oxc:: (полный список см. в разделе группы)
+   */
+  DateRange dates_inperiod_withanyof(const Date& d1, const Date& d2, std::span<oxc_const> properties) const;
+  /**
+   *  Метод возвращает ленивую последовательность дат за указанный период (по возрастанию),
+   *  удовлетворяющих условию query
+   *
+   *  \param [in] d1 верхняя граница периода времени для поиска (включительно)
+   *  \param [in] d2 нижняя граница периода времени для поиска (включительно)
+   *  \param [in] query логическое выражение над свойствами дат ( см. описание класса PropertyQuery )
+   */
+  DateRange dates_inperiod_matching(const Date& d1, const Date& d2, const PropertyQuery& query) const;
   /**
    *  Метод возвращает текстовое описание даты.
    *
@@ -632,6 +1174,102 @@ public:
    *  Возвращаемый bool это флаг определяющий учитывать ли апостол, при вычислении осенней отступкu литургийных чтений.
    */
   std::pair<std::vector<uint8_t>, bool> get_options() const;
+  /**
+   *  Метод устанавливает ограничения хранилища вычисленных годов календаря. Ограничения действуют
+   *  для всех календарей, разделяющих хранилище, а для хранилища по умолчанию (shared_year_store())
+   *  - для всего процесса. При превышении любого из ограничений
+   *  из кэша удаляются давно не использованные годы (кроме закрепленных). Ограничения применяются
+   *  к каждому из внутренних сегментов кэша пропорционально, поэтому соблюдаются приблизительно.
+   *
+   *  \param [in] max_years максимальное кол-во годов в кэше (0 - без ограничения; по умолчанию 10000).
+   *  \param [in] max_bytes максимальный объем памяти занимаемой кэшем в байтах (0 - без ограничения).
+   */
+  void set_cache_limits(const std::size_t max_years, const std::size_t max_bytes=0);
+  /**
+   *  Метод закрепляет в хранилище годы из интервала [from; to] по юлианскому календарю. Закрепленные годы
+   *  не удаляются из хранилища при превышении ограничений и при вызове trim_cache(). Раскладка юлианского
+   *  года повторяется через 532 года и такие годы хранятся как один, поэтому закрепляются также все
+   *  годы, отстоящие от годов интервала на число, кратное 532.
+   *  Если оба параметра - пустые строки, закрепление снимается. Интервал один на хранилище: вызов
+   *  заменяет закрепление, заданное любым календарем с тем же хранилищем (по умолчанию - общим для процесса).
+   *
+   *  \param [in] from первый год интервала.
+   *  \param [in] to последний год интервала.
+   *  \throw std::runtime_error если год задан некорректно.
+   */
+  void set_cache_pinned_years(const Year& from, const Year& to);
+  /**
+   *  Метод удаляет из хранилища все вычисленные годы, кроме закрепленных. Годы удаляются и для
+   *  остальных календарей с тем же хранилищем (по умолчанию - общим хранилищем процесса).
+   */
+  void trim_cache();
+  /**
+   *  Метод полностью очищает хранилище вычисленных годов, включая закрепленные. Как и trim_cache(),
+   *  действует на все календари с тем же хранилищем (по умолчанию - общим хранилищем процесса).
+   */
+  void clear_cache();
+  /**
+   *  Метод возвращает снимок статистики хранилища вычисленных годов. Счетчики общие для всех
+   *  календарей с тем же хранилищем, поэтому включают и их обращения.
+   */
+  CacheStats cache_stats() const;
+  /**
+   *  Метод устанавливает функцию-обработчик событий хранилища вычисленных годов (пустая функция
+   *  удаляет обработчик). Обработчик вызывается в потоке, в котором произошло событие, и не должен
+   *  выбрасывать исключения (они игнорируются); обращаться к календарю из обработчика допускается.
+   *  Обработчик принадлежит хранилищу, а не календарю: он один на хранилище, заменяет обработчик,
+   *  установленный другим календарем, и получает события всех календарей с этим хранилищем. Для
+   *  хранилища по умолчанию (shared_year_store()) обработчик глобален для процесса; для отдельного
+   *  обработчика создайте календарь с собственным хранилищем (см. make_year_store()).
+   */
+  void set_cache_hook(CacheHook hook);
+  /**
+   *  Метод параллельно вычисляет (полностью, со всеми фазами) отсутствующие в хранилище годы
+   *  интервала [from; to] по юлианскому календарю с текущими настройками календаря. Метод
+   *  возвращает управление после вычисления всех годов интервала.
+   *
+   *  \param [in] from первый год интервала.
+   *  \param [in] to последний год интервала.
+   *  \param [in] threads кол-во потоков (0 - по кол-ву ядер процессора).
+   *  \throw std::runtime_error если год задан некорректно; также пробрасывается первое исключение,
+   *  возникшее при вычислении годов.
+   */
+  void prefetch(const Year& from, const Year& to, unsigned threads=0) const;
+  /**
+   *  Метод аналогичен prefetch(from, to, threads), но задачи вычисления годов выполняются
+   *  исполнителем executor.
+   *
+   *  \param [in] from первый год интервала.
+   *  \param [in] to последний год интервала.
+   *  \param [in] executor исполнитель задач.
+   *  \throw std::runtime_error если год задан некорректно или executor пустой; также пробрасывается
+   *  первое исключение, возникшее при вычислении годов или при передаче задачи исполнителю.
+   */
+  void prefetch(const Year& from, const Year& to, const Executor& executor) const;
+  /**
+   *  Метод включает режим упреждающего вычисления годов для последовательного обхода: при каждом
+   *  обращении календаря к году N годы N+1 ... N+forward (и год N-1, если backward == true)
+   *  ставятся в очередь фонового потока хранилища, если они еще не вычислены. По умолчанию
+   *  режим выключен (forward == 0, backward == false). Вычисленные заранее годы попадают в хранилище
+   *  календаря (по умолчанию - общее хранилище процесса), т.е. прогревают его для всех календарей
+   *  с этим хранилищем и учитываются в его ограничениях и статистике. Фоновый поток принадлежит
+   *  хранилищу и завершается при его уничтожении, а не при уничтожении календаря.
+   *
+   *  \param [in] forward кол-во следующих годов для упреждающего вычисления.
+   *  \param [in] backward вычислять ли предыдущий год.
+   */
+  void set_read_ahead(const unsigned forward=1, const bool backward=false);
+  /**
+   *  Метод задает исполнителя задач для параллельного обхода годов в методах поиска и подсчета
+   *  дат за период. Вызывающий поток всегда сам участвует в обходе и не ждет задач, которые
+   *  исполнитель еще не начал выполнять. По умолчанию обход выполняется последовательно в вызывающем
+   *  потоке; для параллельного обхода можно передать shared_executor() или исполнителя приложения.
+   *
+   *  \param [in] executor исполнитель задач; пустое значение отключает параллельный обход.
+   *  \param [in] tasks наибольшее кол-во задач исполнителя на один запрос
+   *  (0 - по кол-ву ядер процессора - 1, но не менее одной).
+   */
+  void set_parallel_executor(Executor executor, unsigned tasks=0);
 };
 
 /**
@@ -0,0 +1,422 @@
+#include "oxc.h"
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace oxc;
+
+namespace {
+
+int failures = 0;
+std::atomic<long> allocations {0};
+
+void check(bool condition, const char* what)
+{
+  if(!condition) {
+    std::cerr << "FAILED: " << what << '\n';
+    failures++;
+  }
+}
+
+/*----------------------------------------------*/
+/* поиск первой даты в периоде                  */
+/*----------------------------------------------*/
+
+void test_period_first_match()
+{
+  OrthodoxCalendar calendar;
+  //суббота пред Богоявлением в 1144 г. приходится и на 1 января, и на 30 декабря:
+  //поиск в периоде должен находить дату внутри периода, а не первую дату года
+  const Date d1("1144", 2, 1, Julian);
+  const Date d2("1144", 12, 31, Julian);
+  const Date expected("1144", 12, 30, Julian);
+  check(calendar.get_date_inperiod_with(d1, d2, sub_peredbogoyav) == expected,
+        "get_date_inperiod_with: 1144-02-01 ... 1144-12-31, sub_peredbogoyav");
+  std::array<oxc_const, 1> properties {sub_peredbogoyav};
+  check(calendar.get_date_inperiod_withanyof(d1, d2, properties) == expected,
+        "get_date_inperiod_withanyof: 1144-02-01 ... 1144-12-31, sub_peredbogoyav");
+  check(calendar.get_date_inperiod_withallof(d1, d2, properties) == expected,
+        "get_date_inperiod_withallof: 1144-02-01 ... 1144-12-31, sub_peredbogoyav");
+  check(calendar.get_date_inperiod_matching(d1, d2, OrthodoxCalendar::PropertyQuery::property(sub_peredbogoyav))
+        == expected, "get_date_inperiod_matching: 1144-02-01 ... 1144-12-31, sub_peredbogoyav");
+}
+
+/*----------------------------------------------*/
+/* выделения памяти при попадании в кэш         */
+/*----------------------------------------------*/
+
+void test_cached_lookup_allocations()
+{
+  OrthodoxCalendar calendar;
+  const Date d("2024", 5, 5, Julian);
+  //первое обращение строит год и кладет его в кэш
+  const auto glas = calendar.date_glas(d);
+  const bool is_pasha = calendar.is_date_of(d, pasha);
+  bool same = true;
+  const long before = allocations.load();
+  for(int i=0; i<1000; i++) {
+    same = same && calendar.date_glas(d) == glas;
+    same = same && calendar.is_date_of(d, pasha) == is_pasha;
+  }
+  const long count = allocations.load() - before;
+  check(same, "cached lookup: repeated calls return the same result");
+  check(count == 0, "cached lookup: date_glas / is_date_of do not allocate on a cache hit");
+}
+
+/*----------------------------------------------*/
+/* is_date_of и date_properties                 */
+/*----------------------------------------------*/
+
+bool is_date_of_matches_properties(const OrthodoxCalendar& calendar, const Date& d)
+{
+  static constexpr std::array<oxc_const, 12> probes {pasha, m1d1, sretenie, sub_peredbogoyav, post_vel, vel_prazd,
+      sobor_valaam, mari_icon_05, ned_peredbogoyav, post_rojd, post_usp, post_petr};
+  const auto properties = calendar.date_properties(d);
+  for(auto p: properties) if(!calendar.is_date_of(d, p)) return false;
+  for(auto p: probes) {
+    const bool listed = std::find(properties.begin(), properties.end(), p) != properties.end();
+    if(calendar.is_date_of(d, p) != listed) return false;
+  }
+  return true;
+}
+
+void test_is_date_of()
+{
+  OrthodoxCalendar calendar;
+  bool same = true;
+  for(Date d("1999", 12, 1, Julian), end("2001", 2, 1, Julian); d <= end; d = d.inc_by_days())
+    same = same && is_date_of_matches_properties(calendar, d);
+  check(same, "is_date_of == date_properties: 1999-12-01 ... 2001-02-01");
+  same = true;
+  for(const std::string y: {"3", "532", "533", "100000000000000000000"}) {
+    for(Date d(y, 1, 1, Julian), end(y, 12, 31, Julian); d <= end; d = d.inc_by_days(7))
+      same = same && is_date_of_matches_properties(calendar, d);
+    same = same && is_date_of_matches_properties(calendar, Date(y, 12, 31, Julian));
+  }
+  check(same, "is_date_of == date_properties: years 3, 532, 533, 10^20");
+  check(!calendar.is_date_of(Date(), pasha), "is_date_of: empty date");
+}
+
+/*----------------------------------------------*/
+/* упреждающее вычисление годов                 */
+/*----------------------------------------------*/
+
+bool read_ahead_matches(OrthodoxCalendar& calendar, const OrthodoxCalendar& reference)
+{
+  calendar.set_read_ahead(3, true);
+  bool same = true;
+  for(int y=1990; y<2010; y++) {
+    const Date d(std::to_string(y), 6, 15, Julian);
+    same = same && calendar.date_glas(d) == reference.date_glas(d);
+    same = same && calendar.date_properties(d) == reference.date_properties(d);
+  }
+  return same;
+}
+
+void test_read_ahead()
+{
+  const OrthodoxCalendar reference(OrthodoxCalendar::make_year_store());
+  bool same = true;
+  //календарь создается, запускает фоновое вычисление и уничтожается, пока поток хранилища работает
+  for(int i=0; i<4; i++) {
+    OrthodoxCalendar calendar(OrthodoxCalendar::make_year_store());
+    same = same && read_ahead_matches(calendar, reference);
+  }
+  for(int i=0; i<4; i++) {
+    OrthodoxCalendar calendar;
+    same = same && read_ahead_matches(calendar, reference);
+  }
+  check(same, "read ahead: results match a calendar without read ahead");
+}
+
+/*----------------------------------------------*/
+/* поиск и подсчет дат за период                */
+/*----------------------------------------------*/
+
+std::vector<Date> brute_dates(const OrthodoxCalendar& calendar, const Date& d1, const Date& d2, oxc_const property)
+{
+  std::vector<Date> result;
+  for(Date d = d1; d <= d2; d = d.inc_by_days())
+    if(calendar.is_date_of(d, property)) result.push_back(d);
+  return result;
+}
+
+std::vector<Date> brute_saturdays(const OrthodoxCalendar& calendar, const Date& d1, const Date& d2, oxc_const property)
+{
+  std::vector<Date> result;
+  for(Date d = d1; d <= d2; d = d.inc_by_days())
+    if(d.weekday() == 6 && calendar.is_date_of(d, property)) result.push_back(d);
+  return result;
+}
+
+std::vector<Date> collect(OrthodoxCalendar::DateRange range)
+{
+  std::vector<Date> result;
+  for(const auto& d: range) result.push_back(d);
+  return result;
+}
+
+void test_period_queries()
+{
+  OrthodoxCalendar calendar;
+  static constexpr std::array<oxc_const, 6> probes {pasha, m1d1, sub_peredbogoyav, post_vel, post_rojd, post_usp};
+  const Date d1("1999", 11, 20, Julian);
+  const Date d2("2003", 2, 10, Julian);
+  bool counts = true, anys = true, ranges = true;
+  for(auto p: probes) {
+    const auto expected = brute_dates(calendar, d1, d2, p);
+    std::array<oxc_const, 1> one {p};
+    const auto query = OrthodoxCalendar::PropertyQuery::property(p);
+    counts = counts && calendar.count_dates_with(d1, d2, p) == expected.size();
+    counts = counts && calendar.count_dates_with(d2, d1, p) == expected.size();
+    counts = counts && calendar.count_dates_withanyof(d1, d2, one) == expected.size();
+    counts = counts && calendar.count_dates_matching(d1, d2, query) == expected.size();
+    anys = anys && calendar.any_date_with(d1, d2, p) == !expected.empty();
+    anys = anys && calendar.any_date_withanyof(d1, d2, one) == !expected.empty();
+    anys = anys && calendar.any_date_matching(d1, d2, query) == !expected.empty();
+    ranges = ranges && calendar.get_alldates_inperiod_with(d1, d2, p) == expected;
+    ranges = ranges && collect(calendar.dates_inperiod_with(d1, d2, p)) == expected;
+    ranges = ranges && collect(calendar.dates_inperiod_withanyof(d1, d2, one))
+        == calendar.get_alldates_inperiod_withanyof(d1, d2, one);
+    ranges = ranges && collect(calendar.dates_inperiod_matching(d1, d2, query))
+        == calendar.get_alldates_inperiod_matching(d1, d2, query);
+  }
+  //составное условие и объединение свойств
+  const auto saturdays = brute_saturdays(calendar, d1, d2, post_vel);
+  const auto query = OrthodoxCalendar::PropertyQuery::weekday(6) && OrthodoxCalendar::PropertyQuery::property(post_vel);
+  counts = counts && calendar.count_dates_matching(d1, d2, query) == saturdays.size();
+  ranges = ranges && collect(calendar.dates_inperiod_matching(d1, d2, query)) == saturdays;
+  std::array<oxc_const, 2> posts {post_rojd, post_usp};
+  auto both = brute_dates(calendar, d1, d2, post_rojd);
+  const auto usp = brute_dates(calendar, d1, d2, post_usp);
+  both.insert(both.end(), usp.begin(), usp.end());
+  std::sort(both.begin(), both.end());
+  both.erase(std::unique(both.begin(), both.end()), both.end());
+  counts = counts && calendar.count_dates_withanyof(d1, d2, posts) == both.size();
+  ranges = ranges && collect(calendar.dates_inperiod_withanyof(d1, d2, posts)) == both;
+  //период без искомых дат
+  const Date e1("2001", 5, 1, Julian), e2("2001", 12, 31, Julian);
+  anys = anys && !calendar.any_date_with(e1, e2, pasha) && calendar.count_dates_with(e1, e2, pasha) == 0;
+  anys = anys && collect(calendar.dates_inperiod_with(e1, e2, pasha)).empty();
+  check(counts, "count_dates_*: equal to a day-by-day scan");
+  check(anys, "any_date_*: equal to a day-by-day scan");
+  check(ranges, "dates_inperiod_*: equal to get_alldates_inperiod_* and a day-by-day scan");
+}
+
+/*----------------------------------------------*/
+/* ближайшая дата до / после указанной          */
+/*----------------------------------------------*/
+
+void test_next_prev()
+{
+  OrthodoxCalendar calendar;
+  const Date pasha1999 = calendar.get_date_with("1999", pasha);
+  const Date pasha2000 = calendar.get_date_with("2000", pasha);
+  std::array<oxc_const, 1> one {pasha};
+  const auto query = OrthodoxCalendar::PropertyQuery::property(pasha);
+  const Date from("1999", 12, 1, Julian);
+  check(calendar.next_date_with(from, pasha) == pasha2000
+        && calendar.next_date_withanyof(from, one) == pasha2000
+        && calendar.next_date_withallof(from, one) == pasha2000
+        && calendar.next_date_matching(from, query) == pasha2000, "next_date_*: across a year boundary");
+  const Date to("2000", 2, 1, Julian);
+  check(calendar.prev_date_with(to, pasha) == pasha1999
+        && calendar.prev_date_withanyof(to, one) == pasha1999
+        && calendar.prev_date_withallof(to, one) == pasha1999
+        && calendar.prev_date_matching(to, query) == pasha1999, "prev_date_*: across a year boundary");
+  check(calendar.next_date_with(pasha1999, pasha) == pasha2000
+        && calendar.prev_date_with(pasha2000, pasha) == pasha1999, "next_date_* / prev_date_*: from itself is skipped");
+  check(calendar.next_date_with(Date("1999", 12, 31, Julian), m1d1) == Date("2000", 1, 1, Julian)
+        && calendar.prev_date_with(Date("2000", 1, 1, Julian), m1d1) == Date("1999", 1, 1, Julian),
+        "next_date_* / prev_date_*: 1 January");
+}
+
+/*----------------------------------------------*/
+/* представление года и сводные данные дня      */
+/*----------------------------------------------*/
+
+bool same_day(const OrthodoxCalendar& calendar, const Date& d, const OrthodoxCalendar::DayInfo& x)
+{
+  const auto properties = calendar.date_properties(d);
+  return x.glas == calendar.date_glas(d) && x.n50 == calendar.date_n50(d)
+      && std::ranges::equal(x.properties(), properties)
+      && x.apostol == calendar.date_apostol(d) && x.evangelie == calendar.date_evangelie(d)
+      && x.resurrect_evangelie == calendar.resurrect_evangelie(d);
+}
+
+void test_year_view_and_day_info()
+{
+  OrthodoxCalendar calendar;
+  bool view_ok = true, info_ok = true;
+  for(const std::string y: {"1999", "2000"}) {
+    const auto view = calendar.year_view(y);
+    view_ok = view_ok && view.year() == y && view.days_count() == (view.is_leap() ? 366 : 365);
+    for(int k=0; k<view.days_count(); k++) {
+      const auto [m, d] = view.date_of_year(k);
+      const Date date(y, m, d, Julian);
+      const auto properties = calendar.date_properties(date);
+      view_ok = view_ok && view.day_of_year(m, d) == k && view.weekday(k) == date.weekday()
+          && view.glas(k) == calendar.date_glas(date) && view.n50(k) == calendar.date_n50(date)
+          && std::ranges::equal(view.properties(k), properties)
+          && view.apostol(k) == calendar.date_apostol(date) && view.evangelie(k) == calendar.date_evangelie(date)
+          && view.resurrect_evangelie(k) == calendar.resurrect_evangelie(date);
+      info_ok = info_ok && same_day(calendar, date, calendar.day_info(date));
+    }
+    for(auto k: view.days_with(pasha)) view_ok = view_ok && calendar.is_date_of(Date(y, view.date_of_year(k).first,
+        view.date_of_year(k).second, Julian), pasha);
+  }
+  check(view_ok, "year_view: equal to the per-date getters");
+  check(info_ok, "day_info: equal to the per-date getters");
+}
+
+/*----------------------------------------------*/
+/* пакетные методы                              */
+/*----------------------------------------------*/
+
+void test_batch()
+{
+  OrthodoxCalendar calendar;
+  std::mt19937 rng(532);
+  std::vector<Date> dates;
+  while(dates.size() < 2000) {
+    const auto y = std::to_string(1900 + rng() % 200);
+    const Month m = 1 + rng() % 12;
+    const Day d = 1 + rng() % 31;
+    if(Date::check(y, m, d, Julian)) dates.emplace_back(y, m, d, Julian);
+  }
+  std::sort(dates.begin(), dates.begin() + 1000);//половина дат упорядочена, половина - нет
+  const auto n = dates.size();
+  std::vector<Weekday> weekday(n);
+  std::vector<int8_t> glas(n), n50(n);
+  std::vector<std::size_t> offs(n+1);
+  std::vector<uint16_t> properties(calendar.dates_properties_count(dates));
+  calendar.fill_day_columns(dates, {weekday, glas, n50, offs, properties});
+  bool columns_ok = offs.front() == 0 && offs.back() == properties.size();
+  for(std::size_t i=0; i<n; i++) {
+    const auto p = calendar.date_properties(dates[i]);
+    columns_ok = columns_ok && weekday[i] == dates[i].weekday() && glas[i] == calendar.date_glas(dates[i])
+        && n50[i] == calendar.date_n50(dates[i])
+        && std::equal(p.begin(), p.end(), properties.begin() + offs[i], properties.begin() + offs[i+1])
+        && offs[i+1] - offs[i] == p.size();
+  }
+  check(columns_ok, "fill_day_columns: equal to the per-date getters");
+  std::vector<int8_t> glas_only(n);
+  calendar.fill_day_columns(dates, {{}, glas_only, {}, {}, {}});
+  check(glas_only == glas, "fill_day_columns: single column");
+  bool thrown = false;
+  try {
+    calendar.fill_day_columns(dates, {{}, {}, {}, offs, std::span(properties).first(properties.size()-1)});
+  } catch(const std::runtime_error&) {
+    thrown = true;
+  }
+  check(thrown, "fill_day_columns: throws if the properties buffer is too small");
+  std::array<oxc_const, 6> probes {pasha, m1d1, post_vel, vel_prazd, post_rojd, ned_peredbogoyav};
+  std::vector<uint64_t> masks(n);
+  calendar.dates_property_masks(dates, probes, masks);
+  bool masks_ok = true;
+  for(std::size_t i=0; i<n; i++) {
+    uint64_t expected {};
+    for(std::size_t j=0; j<probes.size(); j++)
+      if(calendar.is_date_of(dates[i], probes[j])) expected |= uint64_t{1} << j;
+    masks_ok = masks_ok && masks[i] == expected;
+  }
+  check(masks_ok, "dates_property_masks: equal to is_date_of");
+}
+
+/*----------------------------------------------*/
+/* хранилище вычисленных годов                  */
+/*----------------------------------------------*/
+
+void test_cache()
+{
+  OrthodoxCalendar calendar(OrthodoxCalendar::make_year_store());
+  auto glas = [&calendar](int y){ return calendar.date_glas(Date(std::to_string(y), 3, 1, Julian)); };
+  glas(2000);
+  glas(2000);
+  auto s = calendar.cache_stats();
+  check(s.misses == 1 && s.hits == 1 && s.entries == 1 && s.bytes > 0, "cache stats: one miss, one hit");
+  glas(2000 + 532);
+  s = calendar.cache_stats();
+  check(s.misses == 1 && s.hits == 2 && s.entries == 1, "cache stats: year + 532 shares the cached year");
+  calendar.set_cache_pinned_years("2000", "2001");
+  for(int y=2001; y<2040; y++) glas(y);
+  calendar.set_cache_limits(4);
+  s = calendar.cache_stats();
+  check(s.evictions > 0 && s.entries < 40, "cache limits: years are evicted");
+  calendar.trim_cache();
+  s = calendar.cache_stats();
+  check(s.entries == 2, "trim_cache: pinned years stay in the store");
+  const auto misses = s.misses;
+  glas(2000);
+  glas(2001 + 532);
+  check(calendar.cache_stats().misses == misses, "pinned years: no rebuild after trim_cache");
+  calendar.clear_cache();
+  s = calendar.cache_stats();
+  check(s.entries == 0 && s.bytes == 0 && s.clears == 1, "clear_cache: store is empty");
+  glas(2000);
+  check(calendar.cache_stats().misses == misses + 1, "clear_cache: pinned years are rebuilt");
+  calendar.set_cache_limits(10000);
+}
+
+/*----------------------------------------------*/
+/* повтор раскладки через 532 года              */
+/*----------------------------------------------*/
+
+void test_julian_cycle()
+{
+  OrthodoxCalendar calendar;
+  bool same = true;
+  for(int y: {7, 1700, 2024}) {
+    const auto y1 = std::to_string(y), y2 = std::to_string(y + 532);
+    const Date p1 = calendar.get_date_with(y1, pasha), p2 = calendar.get_date_with(y2, pasha);
+    same = same && p1.month() == p2.month() && p1.day() == p2.day();
+    for(Date d1(y1, 1, 1, Julian), end(y1, 12, 31, Julian); d1 <= end; d1 = d1.inc_by_days()) {
+      const Date d2(y2, d1.month(), d1.day(), Julian);
+      const auto a = calendar.day_info(d1), b = calendar.day_info(d2);
+      same = same && d1.weekday() == d2.weekday() && a.glas == b.glas && a.n50 == b.n50
+          && std::ranges::equal(a.properties(), b.properties())
+          && a.apostol == b.apostol && a.evangelie == b.evangelie && a.resurrect_evangelie == b.resurrect_evangelie;
+    }
+  }
+  check(same, "years Y and Y+532 have the same layout");
+}
+
+}
+
+//замена глобальных операторов для подсчета выделений памяти (см. test_cached_lookup_allocations).
+//gcc после встраивания принимает пару operator new / free за несовпадающие функции
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+  allocations++;
+  if(void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+int main()
+{
+  test_period_first_match();
+  test_cached_lookup_allocations();
+  test_is_date_of();
+  test_read_ahead();
+  test_period_queries();
+  test_next_prev();
+  test_year_view_and_day_info();
+  test_batch();
+  test_cache();
+  test_julian_cycle();
+  return failures ? 1 : 0;
+}